@@ -203,6 +203,7 @@ Version 10: FB3.0.
 
 Version 11: FB4.0.
 			SQL SECURITY feature, tables RDB$PUBLICATIONS/RDB$PUBLICATION_TABLES.
+			FB4.1: RDB$CONDITION_SOURCE and RDB$CONDITION_BLR in indices.
 */
 
 const int ATT_BACKUP_FORMAT		= 11;
@@ -349,6 +350,8 @@ enum att_type {
 	att_index_description2,
 	att_index_expression_source,
 	att_index_expression_blr,
+	att_index_condition_source,
+	att_index_condition_blr,
 
 	// Data record
 
@@ -189,6 +189,8 @@ enum ConfigKey
 	KEY_USE_FILESYSTEM_CACHE,
 	KEY_INLINE_SORT_THRESHOLD,
 	KEY_TEMP_PAGESPACE_DIR,
+	KEY_WIRE_PIPELINE,
+	KEY_PROFILE_RECORD_SOURCES,
 	MAX_CONFIG_KEY		// keep it last
 };
 
@@ -304,7 +306,9 @@ constexpr ConfigEntry entries[MAX_CONFIG_KEY] =
 	{TYPE_STRING,	"DataTypeCompatibility",	false,	nullptr},
 	{TYPE_BOOLEAN,	"UseFileSystemCache",		false,	true},
 	{TYPE_INTEGER,	"InlineSortThreshold",		false,	1000},		// bytes
-	{TYPE_STRING,	"TempTableDirectory",		false,	""}
+	{TYPE_STRING,	"TempTableDirectory",		false,	""},
+	{TYPE_BOOLEAN,	"WirePipeline",				false,	false},
+	{TYPE_BOOLEAN,	"ProfileRecordSources",		false,	false}
 };
 
 
@@ -629,6 +633,10 @@ public:
 	CONFIG_GET_PER_DB_KEY(ULONG, getInlineSortThreshold, KEY_INLINE_SORT_THRESHOLD, getInt);
 
 	CONFIG_GET_PER_DB_STR(getTempPageSpaceDirectory, KEY_TEMP_PAGESPACE_DIR);
+
+	CONFIG_GET_PER_DB_BOOL(getWirePipeline, KEY_WIRE_PIPELINE);
+
+	CONFIG_GET_PER_DB_BOOL(getProfileRecordSources, KEY_PROFILE_RECORD_SOURCES);
 };
 
 // Implementation of interface to access master configuration file
@@ -57,6 +57,16 @@ public:
 	virtual void aggPass(thread_db* tdbb, jrd_req* request, dsc* desc) const;
 	virtual dsc* aggExecute(thread_db* tdbb, jrd_req* request) const;
 
+	virtual bool getStateOffsets(Firebird::Array<ULONG>& offsets) const
+	{
+		if (distinct)
+			return false;
+
+		offsets.add(impureOffset);
+		offsets.add(tempImpure);
+		return true;
+	}
+
 protected:
 	virtual AggNode* dsqlCopy(DsqlCompilerScratch* dsqlScratch) /*const*/;
 
@@ -124,6 +134,15 @@ public:
 	virtual void aggPass(thread_db* tdbb, jrd_req* request, dsc* desc) const;
 	virtual dsc* aggExecute(thread_db* tdbb, jrd_req* request) const;
 
+	virtual bool getStateOffsets(Firebird::Array<ULONG>& offsets) const
+	{
+		if (distinct)
+			return false;
+
+		offsets.add(impureOffset);
+		return true;
+	}
+
 protected:
 	virtual AggNode* dsqlCopy(DsqlCompilerScratch* dsqlScratch) /*const*/;
 };
@@ -154,6 +173,15 @@ public:
 	virtual void aggPass(thread_db* tdbb, jrd_req* request, dsc* desc) const;
 	virtual dsc* aggExecute(thread_db* tdbb, jrd_req* request) const;
 
+	virtual bool getStateOffsets(Firebird::Array<ULONG>& offsets) const
+	{
+		if (distinct)
+			return false;
+
+		offsets.add(impureOffset);
+		return true;
+	}
+
 protected:
 	virtual AggNode* dsqlCopy(DsqlCompilerScratch* dsqlScratch) /*const*/;
 };
@@ -185,6 +213,15 @@ public:
 	virtual void aggPass(thread_db* tdbb, jrd_req* request, dsc* desc) const;
 	virtual dsc* aggExecute(thread_db* tdbb, jrd_req* request) const;
 
+	virtual bool getStateOffsets(Firebird::Array<ULONG>& offsets) const
+	{
+		if (distinct)
+			return false;
+
+		offsets.add(impureOffset);
+		return true;
+	}
+
 protected:
 	virtual AggNode* dsqlCopy(DsqlCompilerScratch* dsqlScratch) /*const*/;
 
@@ -1719,6 +1719,8 @@ public:
 		{
 			expressionBlr.clear();
 			expressionSource.clear();
+			conditionBlr.clear();
+			conditionSource.clear();
 		}
 
 		MetaName relation;
@@ -1729,6 +1731,8 @@ public:
 		SSHORT type;
 		bid expressionBlr;
 		bid expressionSource;
+		bid conditionBlr;
+		bid conditionSource;
 		MetaName refRelation;
 		Firebird::ObjectsArray<MetaName> refColumns;
 	};
@@ -1741,7 +1745,8 @@ public:
 		  descending(false),
 		  relation(NULL),
 		  columns(NULL),
-		  computed(NULL)
+		  computed(NULL),
+		  partial(NULL)
 	{
 	}
 
@@ -1767,6 +1772,7 @@ public:
 	NestConst<RelationSourceNode> relation;
 	NestConst<ValueListNode> columns;
 	NestConst<ValueSourceClause> computed;
+	NestConst<BoolSourceClause> partial;
 };
 
 
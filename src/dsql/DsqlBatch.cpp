@@ -662,6 +662,10 @@ private:
 	const dsql_msg* message = m_request->getStatement()->getSendMsg();
 	bool startRequest = true;
 
+	// All messages of a batch share the same format, therefore metadata
+	// is parsed for the first message only
+	IMessageMetadata* meta = m_meta;
+
 	// process messages
 	ULONG remains;
 	UCHAR* data;
@@ -716,7 +720,8 @@ private:
 			}
 
 			// map message to internal engine format
-			m_request->mapInOut(tdbb, false, message, m_meta, NULL, data);
+			m_request->mapInOut(tdbb, false, message, meta, NULL, data);
+			meta = NULL;
 			data += m_messageSize;
 			remains -= m_messageSize;
 
@@ -1053,6 +1053,14 @@ public:
 	virtual void aggPass(thread_db* tdbb, jrd_req* request, dsc* desc) const = 0;
 	virtual dsc* aggExecute(thread_db* tdbb, jrd_req* request) const = 0;
 
+	// Collect the impure offsets (of impure_value_ex) keeping the aggregate state, if this
+	// state may be saved and restored by plain copying. It allows many groups to be computed
+	// at once by switching the states between them.
+	virtual bool getStateOffsets(Firebird::Array<ULONG>& /*offsets*/) const
+	{
+		return false;
+	}
+
 	virtual AggNode* dsqlPass(DsqlCompilerScratch* dsqlScratch);
 
 protected:
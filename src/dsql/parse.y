@@ -1505,6 +1505,7 @@ create_clause
 				$$ = node;
 			}
 		index_definition(static_cast<CreateIndexNode*>($7))
+		index_condition_opt(static_cast<CreateIndexNode*>($7))
 			{
 				$$ = $7;
 			}
@@ -1636,6 +1637,17 @@ index_definition($createIndexNode)
 		}
 	;
 
+%type index_condition_opt(<createIndexNode>)
+index_condition_opt($createIndexNode)
+	: // nothing
+	| WHERE search_condition
+		{
+			$createIndexNode->partial = newNode<BoolSourceClause>();
+			$createIndexNode->partial->value = $2;
+			$createIndexNode->partial->source = makeParseStr(YYPOSNARG(1), YYPOSNARG(2));
+		}
+	;
+
 
 // CREATE SHADOW
 %type <createShadowNode> shadow_clause
@@ -84,6 +84,16 @@ struct PerformanceInfo
 		WRITES
 	};
 
+	// Time counters (in microseconds), must correspond to RuntimeStatistics::StatType
+	// between TIME_FIRST_ITEM and TIME_LAST_ITEM
+	enum TimeCounters
+	{
+		PAGE_READ_TIME = 19,
+		PAGE_WRITE_TIME,
+		LATCH_WAIT_TIME,
+		LOCK_WAIT_TIME
+	};
+
 	ISC_INT64 pin_time;				// Total operation time in milliseconds
 	ISC_INT64* pin_counters;		// Pointer to allow easy addition of new counters
 
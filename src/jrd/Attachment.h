@@ -502,6 +502,10 @@ public:
 	Firebird::AutoPtr<Replication::TableMatcher> att_repl_matcher;
 	Firebird::Array<Applier*> att_repl_appliers;
 
+	// Last primary data page with free space used by this attachment, by relation id.
+	// Lets concurrent inserters fill different data pages.
+	Firebird::Array<ULONG> att_free_data_pages;
+
 	enum UtilType { UTIL_NONE, UTIL_GBAK, UTIL_GFIX, UTIL_GSTAT };
 
 	UtilType att_utility;
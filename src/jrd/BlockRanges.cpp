@@ -0,0 +1,112 @@
+/*
+ *  The contents of this file are subject to the Initial
+ *  Developer's Public License Version 1.0 (the "License");
+ *  you may not use this file except in compliance with the
+ *  License. You may obtain a copy of the License at
+ *  http://www.ibphoenix.com/main.nfs?a=ibphoenix&page=ibp_idpl.
+ *
+ *  Software distributed under the License is distributed AS IS,
+ *  WITHOUT WARRANTY OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing rights
+ *  and limitations under the License.
+ *
+ *  The Original Code was created for the Firebird Open Source RDBMS project.
+ *
+ *  All Rights Reserved.
+ *  Contributor(s): ______________________________________.
+ */
+
+#include "firebird.h"
+#include "../jrd/BlockRanges.h"
+
+using namespace Jrd;
+using namespace Firebird;
+
+
+bool BlockRanges::isSupported(const dsc* desc)
+{
+	switch (desc->dsc_dtype)
+	{
+	case dtype_short:
+	case dtype_long:
+	case dtype_int64:
+	case dtype_int128:
+	case dtype_real:
+	case dtype_double:
+	case dtype_dec64:
+	case dtype_dec128:
+	case dtype_sql_date:
+	case dtype_sql_time:
+	case dtype_sql_time_tz:
+	case dtype_timestamp:
+	case dtype_timestamp_tz:
+		return desc->dsc_length <= MAX_VALUE_LENGTH;
+
+	default:
+		return false;
+	}
+}
+
+
+FB_UINT64 BlockRanges::getGeneration()
+{
+	MutexLockGuard guard(m_mutex, FB_FUNCTION);
+	return m_generation;
+}
+
+
+void BlockRanges::invalidate(USHORT relId, ULONG ppSequence)
+{
+	MutexLockGuard guard(m_mutex, FB_FUNCTION);
+
+	// Summaries collected before this moment become invalid, as well as
+	// the ones being collected right now
+
+	m_invalidated.put(makeKey(relId, ppSequence), ++m_generation);
+}
+
+
+bool BlockRanges::get(USHORT relId, USHORT fieldId, ULONG ppSequence, Summary& summary)
+{
+	MutexLockGuard guard(m_mutex, FB_FUNCTION);
+
+	const Summary* const cached = m_summaries.get(makeKey(relId, ppSequence, fieldId));
+
+	if (!cached || !isValid(makeKey(relId, ppSequence), cached->generation))
+		return false;
+
+	summary = *cached;
+	return true;
+}
+
+
+void BlockRanges::put(USHORT relId, USHORT fieldId, ULONG ppSequence, const Summary& summary)
+{
+	MutexLockGuard guard(m_mutex, FB_FUNCTION);
+
+	if (!isValid(makeKey(relId, ppSequence), summary.generation))
+		return;
+
+	// Don't let the cache grow infinitely. Everything collected so far
+	// is discarded and summaries being collected become invalid.
+
+	if (m_summaries.count() >= MAX_SUMMARIES || m_invalidated.count() >= MAX_SUMMARIES)
+	{
+		m_summaries.clear();
+		m_invalidated.clear();
+		m_resetGeneration = ++m_generation;
+		return;
+	}
+
+	m_summaries.put(makeKey(relId, ppSequence, fieldId), summary);
+}
+
+
+bool BlockRanges::isValid(FB_UINT64 pageKey, FB_UINT64 generation) const
+{
+	if (generation < m_resetGeneration)
+		return false;
+
+	const FB_UINT64* const invalidated = m_invalidated.get(pageKey);
+	return !invalidated || *invalidated <= generation;
+}
@@ -0,0 +1,96 @@
+/*
+ *  The contents of this file are subject to the Initial
+ *  Developer's Public License Version 1.0 (the "License");
+ *  you may not use this file except in compliance with the
+ *  License. You may obtain a copy of the License at
+ *  http://www.ibphoenix.com/main.nfs?a=ibphoenix&page=ibp_idpl.
+ *
+ *  Software distributed under the License is distributed AS IS,
+ *  WITHOUT WARRANTY OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing rights
+ *  and limitations under the License.
+ *
+ *  The Original Code was created for the Firebird Open Source RDBMS project.
+ *
+ *  All Rights Reserved.
+ *  Contributor(s): ______________________________________.
+ */
+
+#ifndef JRD_BLOCK_RANGES_H
+#define JRD_BLOCK_RANGES_H
+
+#include "firebird.h"
+#include "../common/classes/GenericMap.h"
+#include "../common/classes/locks.h"
+#include "../common/dsc.h"
+
+
+namespace Jrd {
+
+// Min/max summaries of field values per pointer page (block range) of a relation.
+// Summaries are collected by full table scans and are kept only for the pointer
+// pages which data pages are all swept, i.e. contain only the primary record
+// versions visible to every transaction. Any change of the swept state of a data
+// page invalidates the summaries of its pointer page. The cache is in-memory
+// only, thus it makes sense for a database owned by the single process only.
+
+class BlockRanges
+{
+public:
+	static const unsigned MAX_VALUE_LENGTH = 16;
+	static const unsigned MAX_SUMMARIES = 65536;
+
+	struct Summary
+	{
+		FB_UINT64 generation;	// cache generation when collecting was started
+		bool hasValues;			// at least one not NULL value is seen
+		dsc desc;				// data type of the collected values
+		UCHAR minValue[MAX_VALUE_LENGTH];
+		UCHAR maxValue[MAX_VALUE_LENGTH];
+
+		void getMin(dsc* target) const
+		{
+			*target = desc;
+			target->dsc_address = const_cast<UCHAR*>(minValue);
+		}
+
+		void getMax(dsc* target) const
+		{
+			*target = desc;
+			target->dsc_address = const_cast<UCHAR*>(maxValue);
+		}
+	};
+
+	explicit BlockRanges(MemoryPool& p)
+		: m_summaries(p), m_invalidated(p), m_generation(0), m_resetGeneration(0)
+	{}
+
+	static bool isSupported(const dsc* desc);
+
+	FB_UINT64 getGeneration();
+	void invalidate(USHORT relId, ULONG ppSequence);
+
+	bool get(USHORT relId, USHORT fieldId, ULONG ppSequence, Summary& summary);
+	void put(USHORT relId, USHORT fieldId, ULONG ppSequence, const Summary& summary);
+
+private:
+	static FB_UINT64 makeKey(USHORT relId, ULONG ppSequence, USHORT fieldId = 0)
+	{
+		return ((FB_UINT64) relId << 48) | ((FB_UINT64) ppSequence << 16) | fieldId;
+	}
+
+	bool isValid(FB_UINT64 pageKey, FB_UINT64 generation) const;
+
+	typedef Firebird::GenericMap<Firebird::Pair<Firebird::NonPooled<FB_UINT64, Summary> > > SummaryMap;
+	typedef Firebird::GenericMap<Firebird::Pair<Firebird::NonPooled<FB_UINT64, FB_UINT64> > > GenerationMap;
+
+	Firebird::Mutex m_mutex;
+	SummaryMap m_summaries;			// summaries by relation, pointer page and field
+	GenerationMap m_invalidated;	// last invalidation generation by relation and pointer page
+	FB_UINT64 m_generation;
+	FB_UINT64 m_resetGeneration;
+};
+
+} // namespace Jrd
+
+#endif // JRD_BLOCK_RANGES_H
@@ -69,6 +69,11 @@ namespace {
 	const UCHAR CRYPT_INIT = LCK_EX;
 
 	const int MAX_PLUGIN_NAME_LEN = 31;
+
+	// Number of pages processed by crypt thread as a single batch. Pages of a batch are read
+	// ahead from disk, each changed page is written when released. Should divide 1024 -
+	// the number of pages after which crypt thread saves current page into DB header.
+	const ULONG CRYPT_BATCH_PAGES = 256;
 }
 
 
@@ -1032,19 +1037,36 @@ namespace Jrd {
 								continue;
 							}
 
-							// writing page to disk will change it's crypt status in usual way
-							WIN window(DB_PAGE_SPACE, currentPage);
-							Ods::pag* page = CCH_FETCH(tdbb, &window, LCK_write, pag_undefined);
-							if (page && page->pag_type <= pag_max &&
-								(bool(page->pag_flags & Ods::crypted_page) != crypt) &&
-								Ods::pag_crypt_page[page->pag_type])
+							// let the pages of next batch be read from disk in advance
+							const ULONG batchEnd =
+								MIN(lastPage, (currentPage / CRYPT_BATCH_PAGES + 1) * CRYPT_BATCH_PAGES);
+
+							HalfStaticArray<ULONG, CRYPT_BATCH_PAGES> batch;
+							for (ULONG pageNum = currentPage; pageNum < batchEnd; pageNum++)
+								batch.add(pageNum);
+
+							CCH_read_ahead(tdbb, DB_PAGE_SPACE, batch.begin(), batch.getCount());
+
+							while (currentPage < batchEnd && !down())
 							{
-								CCH_MARK_MUST_WRITE(tdbb, &window);
+								// writing page to disk will change it's crypt status in usual way
+								WIN window(DB_PAGE_SPACE, currentPage);
+								Ods::pag* page = CCH_FETCH(tdbb, &window, LCK_write, pag_undefined);
+								if (page && page->pag_type <= pag_max &&
+									(bool(page->pag_flags & Ods::crypted_page) != crypt) &&
+									Ods::pag_crypt_page[page->pag_type])
+								{
+									CCH_MARK_MUST_WRITE(tdbb, &window);
+								}
+								CCH_RELEASE_TAIL(tdbb, &window);
+
+								++currentPage;
+
+								if (currentPage < batchEnd)
+									JRD_reschedule(tdbb);
 							}
-							CCH_RELEASE_TAIL(tdbb, &window);
 
 							// sometimes save currentPage into DB header
-							++currentPage;
 							if ((currentPage & 0x3FF) == 0)
 							{
 								writeDbHeader(tdbb, currentPage);
@@ -31,6 +31,7 @@
 #include "../jrd/ods.h"
 #include "../jrd/lck.h"
 #include "../jrd/Database.h"
+#include "../jrd/BlockRanges.h"
 #include "../jrd/nbak.h"
 #include "../jrd/tra.h"
 #include "../jrd/met_proto.h"
@@ -146,6 +147,7 @@ namespace Jrd
 		}
 
 		delete dbb_tip_cache;
+		delete dbb_block_ranges;
 		delete dbb_monitoring_data;
 		delete dbb_backup_manager;
 		delete dbb_crypto_manager;
@@ -87,6 +87,7 @@ class BackupManager;
 class ExternalFileDirectoryList;
 class MonitoringData;
 class GarbageCollector;
+class BlockRanges;
 class CryptoManager;
 class KeywordsMap;
 
@@ -524,6 +525,7 @@ public:
 	time_t last_flushed_write;			// last flushed write time
 
 	TipCache*		dbb_tip_cache;		// cache of latest known state of all transactions in system
+	BlockRanges*	dbb_block_ranges;	// min/max summaries of swept pointer pages
 	BackupManager*	dbb_backup_manager;						// physical backup manager
 	ISC_TIMESTAMP_TZ dbb_creation_date; 					// creation timestamp in GMT
 	ExternalFileDirectoryList* dbb_external_file_directory_list;
@@ -604,6 +606,7 @@ private:
 		dbb_stats(*p),
 		dbb_lock_owner_id(getLockOwnerId()),
 		dbb_tip_cache(NULL),
+		dbb_block_ranges(NULL),
 		dbb_creation_date(Firebird::TimeZoneUtil::getCurrentGmtTimeStamp()),
 		dbb_external_file_directory_list(NULL),
 		dbb_init_fini(FB_NEW_POOL(*getDefaultMemoryPool()) ExistenceRefMutex()),
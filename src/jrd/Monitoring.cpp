@@ -106,7 +106,7 @@ namespace
 const Format* MonitoringTableScan::getFormat(thread_db* tdbb, jrd_rel* relation) const
 {
 	MonitoringSnapshot* const snapshot = MonitoringSnapshot::create(tdbb);
-	return snapshot->getData(relation)->getFormat();
+	return snapshot->getData(tdbb, relation)->getFormat();
 }
 
 
@@ -114,7 +114,7 @@ bool MonitoringTableScan::retrieveRecord(thread_db* tdbb, jrd_rel* relation,
 										 FB_UINT64 position, Record* record) const
 {
 	MonitoringSnapshot* const snapshot = MonitoringSnapshot::create(tdbb);
-	if (!snapshot->getData(relation)->fetch(position, record))
+	if (!snapshot->getData(tdbb, relation)->fetch(position, record))
 		return false;
 
 	if (relation->rel_id == rel_mon_attachments || relation->rel_id == rel_mon_statements)
@@ -428,7 +428,7 @@ MonitoringSnapshot* MonitoringSnapshot::create(thread_db* tdbb)
 
 
 MonitoringSnapshot::MonitoringSnapshot(thread_db* tdbb, MemoryPool& pool)
-	: SnapshotData(pool)
+	: SnapshotData(pool), m_parsed(pool)
 {
 	SET_TDBB(tdbb);
 
@@ -443,16 +443,16 @@ MonitoringSnapshot::MonitoringSnapshot(thread_db* tdbb, MemoryPool& pool)
 	const AttNumber self_att_id = attachment->att_attachment_id;
 
 	// Initialize record buffers
-	RecordBuffer* const dbb_buffer = allocBuffer(tdbb, pool, rel_mon_database);
-	RecordBuffer* const att_buffer = allocBuffer(tdbb, pool, rel_mon_attachments);
-	RecordBuffer* const tra_buffer = allocBuffer(tdbb, pool, rel_mon_transactions);
-	RecordBuffer* const stmt_buffer = allocBuffer(tdbb, pool, rel_mon_statements);
-	RecordBuffer* const call_buffer = allocBuffer(tdbb, pool, rel_mon_calls);
-	RecordBuffer* const io_stat_buffer = allocBuffer(tdbb, pool, rel_mon_io_stats);
-	RecordBuffer* const rec_stat_buffer = allocBuffer(tdbb, pool, rel_mon_rec_stats);
-	RecordBuffer* const ctx_var_buffer = allocBuffer(tdbb, pool, rel_mon_ctx_vars);
-	RecordBuffer* const mem_usage_buffer = allocBuffer(tdbb, pool, rel_mon_mem_usage);
-	RecordBuffer* const tab_stat_buffer = allocBuffer(tdbb, pool, rel_mon_tab_stats);
+	allocBuffer(tdbb, pool, rel_mon_database);
+	allocBuffer(tdbb, pool, rel_mon_attachments);
+	allocBuffer(tdbb, pool, rel_mon_transactions);
+	allocBuffer(tdbb, pool, rel_mon_statements);
+	allocBuffer(tdbb, pool, rel_mon_calls);
+	allocBuffer(tdbb, pool, rel_mon_io_stats);
+	allocBuffer(tdbb, pool, rel_mon_rec_stats);
+	allocBuffer(tdbb, pool, rel_mon_ctx_vars);
+	allocBuffer(tdbb, pool, rel_mon_mem_usage);
+	allocBuffer(tdbb, pool, rel_mon_tab_stats);
 
 	// Dump our own data and downgrade the lock, if required
 
@@ -501,7 +501,8 @@ MonitoringSnapshot::MonitoringSnapshot(thread_db* tdbb, MemoryPool& pool)
 	// Collect monitoring data. Start by gathering database-level info,
 	// it goes directly to the temporary space (as it's not stored in the shared dump).
 
-	TempSpace temp_space(pool, SCRATCH);
+	m_dump = FB_NEW_POOL(pool) TempSpace(pool, SCRATCH);
+	TempSpace& temp_space = *m_dump;
 
 	{ // scope for putDatabase and its utilities
 
@@ -537,71 +538,51 @@ MonitoringSnapshot::MonitoringSnapshot(thread_db* tdbb, MemoryPool& pool)
 
 		dbb->dbb_monitoring_data->read(user_name_ptr, temp_space);
 	}
+}
 
-	// Parse the dump
 
-	MonitoringData::Reader reader(pool, temp_space);
+RecordBuffer* MonitoringSnapshot::getData(thread_db* tdbb, const jrd_rel* relation)
+{
+	fb_assert(relation);
 
-	SnapshotData::DumpRecord dumpRecord(pool);
-	while (reader.getRecord(dumpRecord))
+	const int rel_id = relation->rel_id;
+
+	if (!m_parsed.exist(rel_id))
 	{
-		const int rid = dumpRecord.getRelationId();
+		parse(tdbb, rel_id);
+		m_parsed.add(rel_id);
+	}
 
-		RecordBuffer* buffer = NULL;
-		Record* record = NULL;
+	return getData(rel_id);
+}
 
-		switch (rid)
-		{
-		case rel_mon_database:
-			buffer = dbb_buffer;
-			break;
-		case rel_mon_attachments:
-			buffer = att_buffer;
-			break;
-		case rel_mon_transactions:
-			buffer = tra_buffer;
-			break;
-		case rel_mon_statements:
-			buffer = stmt_buffer;
-			break;
-		case rel_mon_calls:
-			buffer = call_buffer;
-			break;
-		case rel_mon_io_stats:
-			buffer = io_stat_buffer;
-			break;
-		case rel_mon_rec_stats:
-			buffer = rec_stat_buffer;
-			break;
-		case rel_mon_ctx_vars:
-			buffer = ctx_var_buffer;
-			break;
-		case rel_mon_mem_usage:
-			buffer = mem_usage_buffer;
-			break;
-		case rel_mon_tab_stats:
-			buffer = tab_stat_buffer;
-			break;
-		default:
-			fb_assert(false);
-		}
 
-		if (buffer)
-		{
-			record = buffer->getTempRecord();
-			record->nullify();
-		}
+void MonitoringSnapshot::parse(thread_db* tdbb, int rel_id)
+{
+	// Materialize records of the given relation from the raw dump
+
+	RecordBuffer* const buffer = getData(rel_id);
+	fb_assert(buffer);
+
+	MemoryPool& pool = *tdbb->getDefaultPool();
+	MonitoringData::Reader reader(pool, *m_dump);
+
+	SnapshotData::DumpRecord dumpRecord(pool);
+	while (reader.getRecord(dumpRecord))
+	{
+		if (dumpRecord.getRelationId() != rel_id)
+			continue;
+
+		Record* const record = buffer->getTempRecord();
+		record->nullify();
 
 		bool store_record = false;
 
 		SnapshotData::DumpField dumpField;
 		while (dumpRecord.getField(dumpField))
 		{
-			if (record)
-			{
-				putField(tdbb, record, dumpField);
-				store_record = true;
-			}
+			putField(tdbb, record, dumpField);
+			store_record = true;
 		}
 
 		if (store_record)
@@ -1266,6 +1247,10 @@ void Monitoring::putStatistics(SnapshotData::DumpRecord& record, const RuntimeSt
 	record.storeInteger(f_mon_io_page_writes, statistics.getValue(RuntimeStatistics::PAGE_WRITES));
 	record.storeInteger(f_mon_io_page_fetches, statistics.getValue(RuntimeStatistics::PAGE_FETCHES));
 	record.storeInteger(f_mon_io_page_marks, statistics.getValue(RuntimeStatistics::PAGE_MARKS));
+	record.storeInteger(f_mon_io_page_read_time, statistics.getValue(RuntimeStatistics::TIME_PAGE_READS));
+	record.storeInteger(f_mon_io_page_write_time, statistics.getValue(RuntimeStatistics::TIME_PAGE_WRITES));
+	record.storeInteger(f_mon_io_latch_wait_time, statistics.getValue(RuntimeStatistics::TIME_LATCH_WAITS));
+	record.storeInteger(f_mon_io_lock_wait_time, statistics.getValue(RuntimeStatistics::TIME_LOCK_WAITS));
 	record.write();
 
 	// logical I/O statistics (global)
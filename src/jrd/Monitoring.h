@@ -367,8 +367,19 @@ class MonitoringSnapshot : public SnapshotData
 public:
 	static MonitoringSnapshot* create(thread_db* tdbb);
 
+	using SnapshotData::getData;
+	RecordBuffer* getData(thread_db* tdbb, const jrd_rel* relation);
+
 protected:
 	MonitoringSnapshot(thread_db* tdbb, MemoryPool& pool);
+
+private:
+	void parse(thread_db* tdbb, int rel_id);
+
+	// Raw dump collected from all sessions. It's parsed into the record
+	// buffers on demand, only for the relations actually being read.
+	Firebird::AutoPtr<TempSpace> m_dump;
+	Firebird::HalfStaticArray<int, 16> m_parsed;
 };
 
 
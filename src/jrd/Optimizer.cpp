@@ -96,6 +96,58 @@ namespace
 		return false;
 	}
 
+	// Check the index for being a partial one and, if so, whether its condition
+	// is implied by the booleans available for the given stream. Only the literal
+	// match is recognized: every conjunct of the index condition must be present
+	// among the booleans referencing the given stream only.
+	bool checkIndexCondition(CompilerScratch* csb, const index_desc* idx, StreamType stream,
+							 const OptimizerBlk::opt_conjunct* begin,
+							 const OptimizerBlk::opt_conjunct* end)
+	{
+		fb_assert(idx);
+
+		if (!(idx->idx_flags & idx_condition))
+			return true;
+
+		fb_assert(idx->idx_condition);
+
+		HalfStaticArray<BoolExprNode*, OPT_STATIC_ITEMS> conjuncts;
+		conjuncts.add(idx->idx_condition);
+
+		while (conjuncts.hasData())
+		{
+			BoolExprNode* const condition = conjuncts.pop();
+			BinaryBoolNode* const binaryNode = nodeAs<BinaryBoolNode>(condition);
+
+			if (binaryNode && binaryNode->blrOp == blr_and)
+			{
+				conjuncts.add(binaryNode->arg1);
+				conjuncts.add(binaryNode->arg2);
+				continue;
+			}
+
+			bool found = false;
+
+			for (const OptimizerBlk::opt_conjunct* tail = begin; tail < end && !found; tail++)
+			{
+				BoolExprNode* const node = tail->opt_conjunct_node;
+
+				if (!node || !condition->sameAs(csb, node, true))
+					continue;
+
+				SortedStreamList nodeStreams;
+				node->collectStreams(csb, nodeStreams);
+
+				found = (nodeStreams.getCount() == 1 && nodeStreams[0] == stream);
+			}
+
+			if (!found)
+				return false;
+		}
+
+		return true;
+	}
+
 	ValueExprNode* injectCast(CompilerScratch* csb,
 							  ValueExprNode* value, CastNode*& cast,
 							  const dsc& desc)
@@ -260,6 +312,7 @@ IndexScratch::IndexScratch(MemoryPool& p, thread_db* tdbb, index_desc* ix,
 	upperCount = 0;
 	nonFullMatchedSegments = 0;
 	fuzzy = false;
+	skipScan = false;
 
 	segments.grow(idx->idx_count);
 
@@ -309,6 +362,7 @@ IndexScratch::IndexScratch(MemoryPool& p, const IndexScratch& scratch) :
 	upperCount = scratch.upperCount;
 	nonFullMatchedSegments = scratch.nonFullMatchedSegments;
 	fuzzy = scratch.fuzzy;
+	skipScan = scratch.skipScan;
 	idx = scratch.idx;
 
 	// Allocate needed segments
@@ -396,11 +450,22 @@ OptimizerRetrieval::OptimizerRetrieval(MemoryPool& p, OptimizerBlk* opt,
 	CompilerScratch::csb_repeat* csb_tail = &csb->csb_rpt[this->stream];
 	relation = csb_tail->csb_relation;
 
-	// Allocate needed indexScratches
+	// Allocate needed indexScratches, partial indices are
+	// considered only if the query implies their condition
+
+	const OptimizerBlk::opt_conjunct* const opt_begin =
+		optimizer->opt_conjuncts.begin() + (outerFlag ? optimizer->opt_base_parent_conjuncts : 0);
+
+	const OptimizerBlk::opt_conjunct* const opt_end =
+		innerFlag ? optimizer->opt_conjuncts.begin() + optimizer->opt_base_missing_conjuncts :
+					optimizer->opt_conjuncts.end();
 
 	index_desc* idx = csb_tail->csb_idx->items;
 	for (int i = 0; i < csb_tail->csb_indices; ++i, ++idx)
-		indexScratches.add(IndexScratch(p, tdbb, idx, csb_tail));
+	{
+		if (checkIndexCondition(csb, idx, stream, opt_begin, opt_end))
+			indexScratches.add(IndexScratch(p, tdbb, idx, csb_tail));
+	}
 }
 
 OptimizerRetrieval::~OptimizerRetrieval()
@@ -1013,6 +1078,7 @@ void OptimizerRetrieval::getInversionCandidates(InversionCandidateList* inversio
 		scratch.upperCount = 0;
 		scratch.nonFullMatchedSegments = MAX_INDEX_SEGMENTS + 1;
 		scratch.fuzzy = false;
+		scratch.skipScan = false;
 
 		if (scratch.candidate)
 		{
@@ -1020,8 +1086,35 @@ void OptimizerRetrieval::getInversionCandidates(InversionCandidateList* inversio
 			scratch.selectivity = MAXIMUM_SELECTIVITY;
 
 			bool unique = false;
+			int firstSegment = 0;
+			double skipKeys = 1;
+
+			// If the leading segment is not matched but the next one is, the index
+			// may still be used by probing every distinct key of the leading segment.
+			// This pays off for a few distinct leading keys only. Navigational
+			// retrieval can't do that, so don't try it when there's an ORDER BY.
+
+			const index_desc* const skipIdx = scratch.idx;
 
-			for (int j = 0; j < scratch.idx->idx_count; j++)
+			if (!sort && skipIdx->idx_count > 1 &&
+				!(skipIdx->idx_flags & (idx_descending | idx_expressn)) &&
+				scratch.segments[0]->scanType == segmentScanNone &&
+				scratch.segments[1]->scanType != segmentScanNone &&
+				skipIdx->idx_rpt[0].idx_selectivity > 0)
+			{
+				skipKeys = 1 / skipIdx->idx_rpt[0].idx_selectivity;
+
+				if (skipKeys <= MAXIMUM_SKIP_SCAN_KEYS)
+				{
+					scratch.skipScan = true;
+					scratch.lowerCount = scratch.upperCount = firstSegment = 1;
+					scratch.selectivity = skipIdx->idx_rpt[0].idx_selectivity;
+				}
+				else
+					skipKeys = 1;
+			}
+
+			for (int j = firstSegment; j < scratch.idx->idx_count; j++)
 			{
 				const IndexScratchSegment* const segment = scratch.segments[j];
 
@@ -1164,13 +1257,28 @@ void OptimizerRetrieval::getInversionCandidates(InversionCandidateList* inversio
 						selectivity = DEFAULT_SELECTIVITY;
 				}
 
+				double indexCost = DEFAULT_INDEX_COST;
+				double indexSelectivity = scratch.selectivity;
+				int matchedSegments = MAX(scratch.lowerCount, scratch.upperCount);
+
+				if (scratch.skipScan)
+				{
+					// Every distinct leading key costs its own index descent
+					// and brings its own portion of the matching keys
+					selectivity = MIN(selectivity * skipKeys, MAXIMUM_SELECTIVITY);
+					indexSelectivity = MIN(indexSelectivity * skipKeys, MAXIMUM_SELECTIVITY);
+					indexCost *= skipKeys;
+					matchedSegments--;
+					unique = false;
+				}
+
 				InversionCandidate* invCandidate = FB_NEW_POOL(pool) InversionCandidate(pool);
 				invCandidate->unique = unique;
 				invCandidate->selectivity = selectivity;
 				// Calculate the cost (only index pages) for this index.
-				invCandidate->cost = DEFAULT_INDEX_COST + scratch.selectivity * scratch.cardinality;
+				invCandidate->cost = indexCost + indexSelectivity * scratch.cardinality;
 				invCandidate->nonFullMatchedSegments = scratch.nonFullMatchedSegments;
-				invCandidate->matchedSegments = MAX(scratch.lowerCount, scratch.upperCount);
+				invCandidate->matchedSegments = matchedSegments;
 				invCandidate->indexes = 1;
 				invCandidate->scratch = &scratch;
 				invCandidate->matches.join(matches);
@@ -1324,6 +1432,9 @@ InversionNode* OptimizerRetrieval::makeIndexScanNode(IndexScratch* indexScratch)
 	if (indexScratch->fuzzy)
 		retrieval->irb_generic |= irb_starting;	// Flag the need to use INTL_KEY_PARTIAL in btr.
 
+	if (indexScratch->skipScan)
+		retrieval->irb_generic |= irb_skip_scan;
+
 	// This index is never used for IS NULL, thus we can ignore NULLs
 	// already at index scan. But this rule doesn't apply to nod_equiv
 	// which requires NULLs to be found in the index.
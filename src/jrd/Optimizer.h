@@ -67,6 +67,10 @@ const double THRESHOLD_CARDINALITY = 5.0;
 // so it's not included here.
 const int DEFAULT_INDEX_COST = 3;
 
+// Maximum number of distinct leading keys allowed for a skip scan
+// of a compound index. Each of them costs a separate index lookup.
+const double MAXIMUM_SKIP_SCAN_KEYS = 64.0;
+
 
 struct index_desc;
 class OptimizerBlk;
@@ -122,6 +126,7 @@ public:
 	int upperCount;					//
 	int nonFullMatchedSegments;		//
 	bool fuzzy;						// Need to use INTL_KEY_PARTIAL in btr lookups
+	bool skipScan;					// Leading segment is not matched, probe its distinct keys
 	double cardinality;				// Estimated cardinality when using the whole index
 
 	Firebird::Array<IndexScratchSegment*> segments;
@@ -1704,12 +1704,33 @@ RecordSource* AggregateSourceNode::generate(thread_db* tdbb, OptimizerBlk* opt,
 		rse->flags |= RseNode::FLAG_OPT_FIRST_ROWS;
 	}
 
+	// Let the optimizer choose between sorting and hashing the groups.
+	// The flag is reset by OPT_compile() if the sort is to be kept.
+
+	rse->flags &= ~RseNode::FLAG_HASH_GROUPING;
+
+	if (group && !rse->rse_aggregate && !orderedGroups &&
+		HashAggregatedStream::isSupported(tdbb, csb, &group->expressions, map))
+	{
+		rse->flags |= RseNode::FLAG_HASH_GROUPING;
+	}
+
 	RecordSource* const nextRsb = OPT_compile(tdbb, csb, rse, &deliverStack);
 
 	// allocate and optimize the record source block
 
-	AggregatedStream* const rsb = FB_NEW_POOL(*tdbb->getDefaultPool()) AggregatedStream(tdbb, csb,
-		stream, (group ? &group->expressions : NULL), map, nextRsb);
+	RecordSource* rsb;
+
+	if (rse->flags & RseNode::FLAG_HASH_GROUPING)
+	{
+		rsb = FB_NEW_POOL(*tdbb->getDefaultPool()) HashAggregatedStream(tdbb, csb,
+			stream, &group->expressions, map, nextRsb);
+	}
+	else
+	{
+		rsb = FB_NEW_POOL(*tdbb->getDefaultPool()) AggregatedStream(tdbb, csb,
+			stream, (group ? &group->expressions : NULL), map, nextRsb);
+	}
 
 	if (rse->rse_aggregate)
 	{
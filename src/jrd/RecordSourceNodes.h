@@ -269,6 +269,19 @@ public:
 	NestConst<ValueExprNode> upper;
 };
 
+class BlockRangeNode
+{
+public:
+	BlockRangeNode(USHORT aFieldId, ValueExprNode* aLower, ValueExprNode* aUpper)
+		: fieldId(aFieldId), lower(aLower), upper(aUpper)
+	{
+	}
+
+	USHORT fieldId;
+	NestConst<ValueExprNode> lower;		// inclusive
+	NestConst<ValueExprNode> upper;		// inclusive
+};
+
 class WithClause : public Firebird::Array<SelectExprNode*>
 {
 public:
@@ -534,7 +547,8 @@ public:
 		  group(NULL),
 		  map(NULL),
 		  rse(NULL),
-		  dsqlWindow(false)
+		  dsqlWindow(false),
+		  orderedGroups(false)
 	{
 	}
 
@@ -587,6 +601,7 @@ private:
 
 public:
 	bool dsqlWindow;
+	bool orderedGroups;		// parent relies on the groups being returned in order
 };
 
 class UnionSourceNode : public TypedNode<RecordSourceNode, RecordSourceNode::TYPE_UNION>
@@ -732,6 +747,7 @@ public:
 	static const USHORT FLAG_DSQL_COMPARATIVE	= 0x10;	// transformed from DSQL ComparativeBoolNode
 	static const USHORT FLAG_OPT_FIRST_ROWS		= 0x20;	// optimize retrieval for first rows
 	static const USHORT FLAG_LATERAL			= 0x40;	// lateral derived table
+	static const USHORT FLAG_HASH_GROUPING		= 0x80;	// group by hashing instead of sorting
 
 	explicit RseNode(MemoryPool& pool)
 		: TypedNode<RecordSourceNode, RecordSourceNode::TYPE_RSE>(pool),
@@ -600,4 +600,7 @@ void RelationPages::free(RelationPages*& nextFree)
 
 	dpMap.clear();
 	dpMapMark = 0;
+
+	for (auto& page : rightLeaf)
+		page = 0;
 }
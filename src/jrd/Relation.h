@@ -95,7 +95,10 @@ public:
 		  useCount(0),
 		  dpMap(pool),
 		  dpMapMark(0)
-	{}
+	{
+		for (auto& page : rightLeaf)
+			page = 0;
+	}
 
 	inline SLONG addRef()
 	{
@@ -144,6 +147,18 @@ public:
 		}
 	}
 
+	// Rightmost leaf page of the index, it's just a hint for appending ascending keys
+	ULONG getRightLeaf(USHORT idxId) const
+	{
+		return (idxId < MAX_RIGHT_LEAF_ITEMS) ? rightLeaf[idxId].load(std::memory_order_relaxed) : 0;
+	}
+
+	void setRightLeaf(USHORT idxId, ULONG pageNumber)
+	{
+		if (idxId < MAX_RIGHT_LEAF_ITEMS)
+			rightLeaf[idxId].store(pageNumber, std::memory_order_relaxed);
+	}
+
 	void freeOldestMapItems()
 	{
 		ULONG minMark = MAX_ULONG;
@@ -190,6 +205,10 @@ private:
 	Firebird::SortedArray<DPItem, Firebird::InlineStorage<DPItem, MAX_DPMAP_ITEMS>, ULONG, DPItem> dpMap;
 	ULONG dpMapMark;
 
+	static const USHORT MAX_RIGHT_LEAF_ITEMS = 64;
+
+	std::atomic<ULONG> rightLeaf[MAX_RIGHT_LEAF_ITEMS];
+
 friend class jrd_rel;
 };
 
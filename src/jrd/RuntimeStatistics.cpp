@@ -26,6 +26,7 @@
 
 #include "../jrd/RuntimeStatistics.h"
 #include "../jrd/ntrace.h"
+#include "../common/utils_proto.h"
 
 using namespace Firebird;
 
@@ -33,6 +34,10 @@ namespace Jrd {
 
 GlobalPtr<RuntimeStatistics> RuntimeStatistics::dummy;
 
+static_assert((int) PerformanceInfo::PAGE_READ_TIME == (int) RuntimeStatistics::TIME_PAGE_READS &&
+			  (int) PerformanceInfo::LOCK_WAIT_TIME == (int) RuntimeStatistics::TIME_LOCK_WAITS,
+			  "PerformanceInfo::TimeCounters don't match RuntimeStatistics::StatType");
+
 void RuntimeStatistics::findAndBumpRelValue(const StatType index, SLONG relation_id, SINT64 delta)
 {
 	if (rel_counts.find(relation_id, rel_last_pos))
@@ -153,4 +158,16 @@ RuntimeStatistics::Accumulator::~Accumulator()
 		m_tdbb->bumpRelStats(m_type, m_id, m_counter);
 }
 
+RuntimeStatistics::WaitTimer::WaitTimer(thread_db* tdbb, StatType type)
+	: m_tdbb(tdbb), m_type(type), m_start(fb_utils::query_performance_counter())
+{
+	fb_assert(type >= TIME_FIRST_ITEM && type <= TIME_LAST_ITEM);
+}
+
+RuntimeStatistics::WaitTimer::~WaitTimer()
+{
+	const SINT64 elapsed = fb_utils::query_performance_counter() - m_start;
+	m_tdbb->bumpStats(m_type, elapsed * 1000000 / fb_utils::query_performance_frequency());
+}
+
 } // namespace
@@ -74,6 +74,12 @@ public:
 		RECORD_RPT_READS,
 		RECORD_IMGC,
 		RECORD_LAST_ITEM = RECORD_IMGC,
+		TIME_FIRST_ITEM,
+		TIME_PAGE_READS = TIME_FIRST_ITEM,	// microseconds spent reading pages
+		TIME_PAGE_WRITES,					// microseconds spent writing pages
+		TIME_LATCH_WAITS,					// microseconds spent waiting for page latches
+		TIME_LOCK_WAITS,					// microseconds spent waiting for locks
+		TIME_LAST_ITEM = TIME_LOCK_WAITS,
 		TOTAL_ITEMS		// last
 	};
 
@@ -248,9 +254,10 @@ public:
 		if (baseStats.allChgNumber != newStats.allChgNumber)
 		{
 			const size_t FIRST_ITEM = relStatsOnly ? REL_BASE_OFFSET : 0;
+			const size_t LAST_ITEM = relStatsOnly ? REL_BASE_OFFSET + REL_TOTAL_ITEMS : TOTAL_ITEMS;
 
 			allChgNumber++;
-			for (size_t i = FIRST_ITEM; i < TOTAL_ITEMS; ++i)
+			for (size_t i = FIRST_ITEM; i < LAST_ITEM; ++i)
 				values[i] += newStats.values[i] - baseStats.values[i];
 
 			if (baseStats.relChgNumber != newStats.relChgNumber)
@@ -350,6 +357,20 @@ public:
 		SINT64 m_counter;
 	};
 
+	// Adds time spent in the scope to the given TIME_XXX counter
+
+	class WaitTimer
+	{
+	public:
+		WaitTimer(thread_db* tdbb, StatType type);
+		~WaitTimer();
+
+	private:
+		thread_db* m_tdbb;
+		StatType m_type;
+		SINT64 m_start;
+	};
+
 private:
 	void addRelCounts(const RelCounters& other, bool add);
 
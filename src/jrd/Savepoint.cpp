@@ -156,10 +156,14 @@ void VerbAction::mergeTo(thread_db* tdbb, jrd_tra* transaction, VerbAction* next
 	// all BLOBs it refers to should be cleaned out because under no circumstances
 	// this undo data can become an active record.
 
-	// Merge undo records first
+	// Drop undo records of the records touched by the next savepoint first. Records
+	// which the next savepoint has not seen yet stay in the tree to be passed as a whole.
+	// If there is no next savepoint, all undo records are dropped with the tree.
 
 	if (vct_undo && vct_undo->getFirst())
 	{
+		bool positioned = true;
+
 		do
 		{
 			UndoItem& item = vct_undo->current();
@@ -170,26 +174,7 @@ void VerbAction::mergeTo(thread_db* tdbb, jrd_tra* transaction, VerbAction* next
 
 				if (nextAction && !(RecordBitmap::test(nextAction->vct_records, recordNumber)))
 				{
-					if (!nextAction->vct_undo)
-					{
-						nextAction->vct_undo =
-							FB_NEW_POOL(*transaction->tra_pool) UndoItemTree(*transaction->tra_pool);
-						// We cannot just push whole current undo items list, some items still may be released
-					}
-					else
-					{
-						if (nextAction->vct_undo->locate(recordNumber))
-						{
-							// It looks like something went wrong on previous loop and undo record
-							// was moved to next action but record bit in bitmap wasn't set
-							fb_assert(false);
-							item.clear();
-							continue;
-						}
-					}
-
-					nextAction->vct_undo->add(item);
-					item.clear(); // Do not release undo data, it now belongs to next action
+					positioned = vct_undo->getNext();
 					continue;
 				}
 
@@ -203,7 +188,50 @@ void VerbAction::mergeTo(thread_db* tdbb, jrd_tra* transaction, VerbAction* next
 
 				item.release(transaction);
 			}
-		} while (vct_undo->getNext());
+
+			// Without the next savepoint the whole tree is deleted below,
+			// so there is no need to remove items one by one
+
+			positioned = nextAction ? vct_undo->fastRemove() : vct_undo->getNext();
+		} while (positioned);
+	}
+
+	// Post the remaining undo records to the next savepoint. If it has no undo records
+	// yet, the whole tree is passed, otherwise the smaller tree is merged into the bigger one.
+
+	if (vct_undo)
+	{
+		if (nextAction && !vct_undo->isEmpty())
+		{
+			if (!nextAction->vct_undo)
+			{
+				nextAction->vct_undo = vct_undo;
+				vct_undo = NULL;
+			}
+			else
+			{
+				if (vct_undo->seemsBiggerThan(*nextAction->vct_undo))
+				{
+					UndoItemTree* const temp = nextAction->vct_undo;
+					nextAction->vct_undo = vct_undo;
+					vct_undo = temp;
+				}
+
+				if (vct_undo->getFirst())
+				{
+					do
+					{
+						// Undo data now belongs to the next action. Records are never present in
+						// both trees as the next savepoint keeps undo data for its own records only.
+
+						if (!nextAction->vct_undo->add(vct_undo->current()))
+							fb_assert(false);
+
+						vct_undo->current().clear();
+					} while (vct_undo->getNext());
+				}
+			}
+		}
 
 		delete vct_undo;
 		vct_undo = NULL;
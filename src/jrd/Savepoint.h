@@ -73,6 +73,9 @@ namespace Jrd
 		const Format* m_format;
 	};
 
+	// Only the record images are stored in the transaction undo space (which
+	// spills to disk), the tree itself and the record bitmaps of the verb action
+	// are kept in memory and grow with the number of records changed.
 	typedef Firebird::BePlusTree<UndoItem, SINT64, MemoryPool, UndoItem> UndoItemTree;
 
 	class VerbAction
@@ -77,6 +77,10 @@ using namespace Firebird;
 
 typedef Ods::blob_page blob_page;
 
+// Data pages of a large blob being read are requested from the file system
+// in advance by portions of this size, twice that size ahead
+static const ULONG BLOB_READ_AHEAD_SIZE = 1024 * 1024;	// 1MB
+
 static ArrayField* alloc_array(jrd_tra*, Ods::InternalArrayDesc*);
 //static blb* allocate_blob(thread_db*, jrd_tra*);
 static ISC_STATUS blob_filter(USHORT, BlobControl*);
@@ -2325,13 +2329,18 @@ blob_page* blb::get_next_page(thread_db* tdbb, WIN* window)
 	}
 
 	SET_TDBB(tdbb);
-#ifdef SUPERSERVER_V2
 	Database* dbb = tdbb->getDatabase();
+#ifdef SUPERSERVER_V2
 	ULONG pages[PREFETCH_MAX_PAGES];
 #endif
 
 	const vcl& vector = *blb_pages;
 
+	// Read-ahead makes sense for blobs spanning several portions only
+
+	const ULONG readAhead = BLOB_READ_AHEAD_SIZE / dbb->dbb_page_size;
+	const bool largeBlob = (blb_max_sequence >= readAhead * 2);
+
 	blob_page* page = 0;
 	// Level 1 blobs are much easier -- page number is in vector.
 	if (blb_level == 1)
@@ -2351,6 +2360,12 @@ blob_page* blb::get_next_page(thread_db* tdbb, WIN* window)
 			CCH_PREFETCH(tdbb, pages, i);
 		}
 #endif
+		if (largeBlob && !(blb_sequence % readAhead))
+		{
+			const ULONG count = MIN(readAhead * 2, blb_max_sequence - blb_sequence + 1);
+			CCH_read_ahead(tdbb, blb_pg_space_id, vector.begin() + blb_sequence, count);
+		}
+
 		window->win_page = vector[blb_sequence];
 		page = (blob_page*) CCH_FETCH(tdbb, window, LCK_read, pag_blob);
 	}
@@ -2376,6 +2391,17 @@ blob_page* blb::get_next_page(thread_db* tdbb, WIN* window)
 			CCH_PREFETCH(tdbb, pages, i);
 		}
 #endif
+		// Data pages are read ahead within the current pointer page only
+
+		const ULONG slot = blb_sequence % blb_pointers;
+
+		if (largeBlob && !(slot % readAhead))
+		{
+			const ULONG count = MIN(MIN(readAhead * 2, (ULONG) blb_pointers - slot),
+				blb_max_sequence - blb_sequence + 1);
+			CCH_read_ahead(tdbb, blb_pg_space_id, page->blp_page + slot, count);
+		}
+
 		page = (blob_page*) CCH_HANDOFF(tdbb, window,
 										page->blp_page[blb_sequence % blb_pointers],
 										LCK_read, pag_blob);
@@ -45,6 +45,7 @@
 #include "../jrd/lck.h"
 #include "../jrd/cch.h"
 #include "../jrd/sort.h"
+#include "../dsql/Nodes.h"
 #include "../common/gdsassert.h"
 #include "../jrd/btr_proto.h"
 #include "../jrd/cch_proto.h"
@@ -184,6 +185,43 @@ namespace
 		temporary_key jumpKey;
 	};
 
+	// Single probe of a batched index lookup, see BTR_evaluate_list()
+
+	struct IndexProbe
+	{
+		const IndexRetrieval* retrieval;
+		const UCHAR* lower;
+		const UCHAR* upper;
+		USHORT lowerLength;
+		USHORT upperLength;
+		UCHAR lowerFlags;
+		UCHAR upperFlags;
+
+		static int compareKeys(const UCHAR* key1, USHORT length1, const UCHAR* key2, USHORT length2)
+		{
+			const int result = memcmp(key1, key2, MIN(length1, length2));
+
+			if (result)
+				return result;
+
+			return (length1 > length2) ? 1 : (length1 < length2) ? -1 : 0;
+		}
+
+		bool operator>(const IndexProbe& other) const
+		{
+			return compareKeys(lower, lowerLength, other.lower, other.lowerLength) > 0;
+		}
+
+		bool sameAs(const IndexProbe& other) const
+		{
+			return retrieval->irb_generic == other.retrieval->irb_generic &&
+				retrieval->irb_lower_count == other.retrieval->irb_lower_count &&
+				retrieval->irb_upper_count == other.retrieval->irb_upper_count &&
+				!compareKeys(lower, lowerLength, other.lower, other.lowerLength) &&
+				!compareKeys(upper, upperLength, other.upper, other.upperLength);
+		}
+	};
+
 } // namespace
 
 static ULONG add_node(thread_db*, WIN*, index_insertion*, temporary_key*, RecordNumber*,
@@ -194,6 +232,9 @@ static void copy_key(const temporary_key*, temporary_key*);
 static contents delete_node(thread_db*, WIN*, UCHAR*);
 static void delete_tree(thread_db*, USHORT, USHORT, PageNumber, PageNumber);
 static DSC* eval(thread_db*, const ValueExprNode*, DSC*, bool*);
+static bool check_lower_key_skip(UCHAR*, const temporary_key&, const index_desc*,
+								 const IndexRetrieval*);
+static void evaluate_skip_scan(thread_db*, const IndexRetrieval*, RecordBitmap**, RecordBitmap*);
 static ULONG fast_load(thread_db*, IndexCreation&, SelectivityList&);
 
 static index_root_page* fetch_root(thread_db*, WIN*, const jrd_rel*, const RelationPages*);
@@ -205,13 +246,16 @@ static UCHAR* find_area_start_point(btree_page*, const temporary_key*, UCHAR*,
 
 static ULONG find_page(btree_page*, const temporary_key*, const index_desc*, RecordNumber = NO_VALUE,
 					   bool = false);
+static bool find_skip_node(thread_db*, WIN*, ULONG, const index_desc*, const temporary_key*,
+						   temporary_key*, temporary_key*, UCHAR**);
 
 static contents garbage_collect(thread_db*, WIN*, ULONG);
 static void generate_jump_nodes(thread_db*, btree_page*, JumpNodeList*, USHORT,
 								USHORT*, USHORT*, USHORT*, USHORT);
 
 static ULONG insert_node(thread_db*, WIN*, index_insertion*, temporary_key*,
-						 RecordNumber*, ULONG*, ULONG*);
+						 RecordNumber*, ULONG*, ULONG*, bool = true);
+static bool append_node(thread_db*, index_insertion*);
 
 static INT64_KEY make_int64_key(SINT64, SSHORT);
 #ifdef DEBUG_INDEXKEY
@@ -516,6 +560,8 @@ bool BTR_description(thread_db* tdbb, jrd_rel* relation, index_root_page* root,
 	idx->idx_primary_index = 0;
 	idx->idx_expression = NULL;
 	idx->idx_expression_statement = NULL;
+	idx->idx_condition = NULL;
+	idx->idx_condition_statement = NULL;
 
 	// pick up field ids and type descriptions for each of the fields
 	const UCHAR* ptr = (UCHAR*) root + irt_desc->irt_desc;
@@ -536,10 +582,101 @@ bool BTR_description(thread_db* tdbb, jrd_rel* relation, index_root_page* root,
 		fb_assert(idx->idx_expression != NULL);
 	}
 
+	if (idx->idx_flags & idx_condition)
+	{
+		MET_lookup_index_condition(tdbb, relation, idx);
+		fb_assert(idx->idx_condition != NULL);
+	}
+
 	return true;
 }
 
 
+bool BTR_check_condition(thread_db* tdbb, index_desc* idx, Record* record)
+{
+/**************************************
+ *
+ *	B T R _ c h e c k _ c o n d i t i o n
+ *
+ **************************************
+ *
+ * Functional description
+ *	Check whether the record belongs to a partial index,
+ *	i.e. whether it satisfies the index condition.
+ *	Non-partial indices accept every record.
+ *
+ **************************************/
+	SET_TDBB(tdbb);
+
+	if (!(idx->idx_flags & idx_condition))
+		return true;
+
+	fb_assert(idx->idx_condition != NULL);
+
+	// check for recursive condition evaluation
+	jrd_req* const org_request = tdbb->getRequest();
+	jrd_req* const cond_request = idx->idx_condition_statement->findRequest(tdbb, true);
+
+	if (cond_request == NULL)
+		ERR_post(Arg::Gds(isc_random) << "Attempt to evaluate index condition recursively");
+
+	fb_assert(cond_request != org_request);
+
+	fb_assert(cond_request->req_caller == NULL);
+	cond_request->req_caller = org_request;
+
+	cond_request->req_flags &= req_in_use;
+	cond_request->req_flags |= req_active;
+	TRA_attach_request(tdbb->getTransaction(), cond_request);
+	TRA_setup_request_snapshot(tdbb, cond_request);
+	tdbb->setRequest(cond_request);
+
+	fb_assert(cond_request->req_transaction);
+
+	cond_request->req_rpb[0].rpb_record = record;
+	cond_request->req_rpb[0].rpb_number.setValue(BOF_NUMBER);
+	cond_request->req_rpb[0].rpb_number.setValid(true);
+	cond_request->req_flags &= ~req_null;
+
+	bool result = false;
+
+	try
+	{
+		Jrd::ContextPoolHolder context(tdbb, cond_request->req_pool);
+
+		if (org_request)
+			cond_request->req_gmt_timestamp = org_request->req_gmt_timestamp;
+		else
+			TimeZoneUtil::validateGmtTimeStamp(cond_request->req_gmt_timestamp);
+
+		// NULL (unknown) condition result means the record is not indexed
+		result = idx->idx_condition->execute(tdbb, cond_request);
+	}
+	catch (const Exception&)
+	{
+		EXE_unwind(tdbb, cond_request);
+		tdbb->setRequest(org_request);
+
+		cond_request->req_caller = NULL;
+		cond_request->req_flags &= ~req_in_use;
+		cond_request->req_attachment = NULL;
+		cond_request->req_gmt_timestamp.invalidate();
+
+		throw;
+	}
+
+	EXE_unwind(tdbb, cond_request);
+	tdbb->setRequest(org_request);
+
+	cond_request->req_caller = NULL;
+	cond_request->req_flags &= ~req_in_use;
+	cond_request->req_attachment = NULL;
+	cond_request->req_gmt_timestamp.invalidate();
+
+	return result;
+}
+
+
 DSC* BTR_eval_expression(thread_db* tdbb, index_desc* idx, Record* record, bool& notNull)
 {
 	SET_TDBB(tdbb);
@@ -693,6 +830,12 @@ void BTR_evaluate(thread_db* tdbb, const IndexRetrieval* retrieval, RecordBitmap
  **************************************/
 	SET_TDBB(tdbb);
 
+	if (retrieval->irb_generic & irb_skip_scan)
+	{
+		evaluate_skip_scan(tdbb, retrieval, bitmap, bitmap_and);
+		return;
+	}
+
 	// Remove ignore_nulls flag for older ODS
 	//const Database* dbb = tdbb->getDatabase();
 
@@ -731,39 +874,7 @@ void BTR_evaluate(thread_db* tdbb, const IndexRetrieval* retrieval, RecordBitmap
 		}
 
 		if (skipLowerKey)
-		{
-			IndexNode node;
-			node.readNode(pointer, true);
-
-			if ((lower.key_length == node.prefix + node.length) ||
-				((lower.key_length <= node.prefix + node.length) && partLower))
-			{
-				const UCHAR* p = node.data, *q = lower.key_data + node.prefix;
-				const UCHAR* const end = lower.key_data + lower.key_length;
-				while (q < end)
-				{
-					if (*p++ != *q++)
-					{
-						skipLowerKey = false;
-						break;
-					}
-				}
-
-				if ((q >= end) && (p < node.data + node.length) && skipLowerKey && partLower)
-				{
-					// since key length always is multiplier of (STUFF_COUNT + 1) (for partial
-					// compound keys) and we passed lower key completely then p pointed
-					// us to the next segment number and we can use this fact to calculate
-					// how many segments is equal to lower key
-					const USHORT segnum = idx.idx_count - (UCHAR) (descending ? ((*p) ^ -1) : *p);
-
-					if (segnum < retrieval->irb_lower_count)
-						skipLowerKey = false;
-				}
-			}
-			else
-				skipLowerKey = false;
-		}
+			skipLowerKey = check_lower_key_skip(pointer, lower, &idx, retrieval);
 	}
 	else
 	{
@@ -845,6 +956,221 @@ void BTR_evaluate(thread_db* tdbb, const IndexRetrieval* retrieval, RecordBitmap
 }
 
 
+void BTR_evaluate_list(thread_db* tdbb, FB_SIZE_T count, const IndexRetrieval* const* retrievals,
+					   RecordBitmap** bitmap, RecordBitmap* bitmap_and)
+{
+/**************************************
+ *
+ *	B T R _ e v a l u a t e _ l i s t
+ *
+ **************************************
+ *
+ * Functional description
+ *	Do a series of index scans against the same index
+ *	(e.g. for IN predicate) and collect all candidate
+ *	record numbers into a single bitmap.
+ *
+ *	The probes are sorted by their lower keys and evaluated
+ *	left to right. The leaf page the previous probe stopped at
+ *	(or its right sibling) is reused when the next lower key
+ *	is found there, otherwise the index is descended again.
+ *
+ **************************************/
+	SET_TDBB(tdbb);
+
+	bool batched = (count > 1);
+
+	for (FB_SIZE_T i = 0; batched && i < count; i++)
+	{
+		const IndexRetrieval* const retrieval = retrievals[i];
+
+		if (retrieval->irb_key || !retrieval->irb_lower_count || !retrieval->irb_upper_count ||
+			(retrieval->irb_generic & irb_skip_scan) ||
+			retrieval->irb_index != retrievals[0]->irb_index)
+		{
+			batched = false;
+		}
+	}
+
+	if (!batched)
+	{
+		for (FB_SIZE_T i = 0; i < count; i++)
+			BTR_evaluate(tdbb, retrievals[i], bitmap, bitmap_and);
+
+		return;
+	}
+
+	// Generate all keys before we get any pages locked
+
+	MemoryPool& pool = *tdbb->getDefaultPool();
+	HalfStaticArray<ULONG, 16> offsets(pool);
+	UCharBuffer keys(pool);
+	temporary_key lower, upper;
+
+	for (FB_SIZE_T i = 0; i < count; i++)
+	{
+		const IndexRetrieval* const retrieval = retrievals[i];
+		const bool fuzzy = (retrieval->irb_generic & irb_starting);
+
+		idx_e errorCode = BTR_make_key(tdbb, retrieval->irb_upper_count,
+									   retrieval->irb_value + retrieval->irb_desc.idx_count,
+									   &retrieval->irb_desc, &upper, fuzzy);
+
+		if (errorCode == idx_e_ok)
+		{
+			errorCode = BTR_make_key(tdbb, retrieval->irb_lower_count,
+									 retrieval->irb_value, &retrieval->irb_desc, &lower, fuzzy);
+		}
+
+		if (errorCode != idx_e_ok)
+		{
+			index_desc temp_idx = retrieval->irb_desc; // to avoid constness issues
+			IndexErrorContext context(retrieval->irb_relation, &temp_idx);
+			context.raise(tdbb, errorCode, NULL);
+		}
+
+		offsets.add(keys.getCount());
+		keys.add(&lower.key_flags, 1);
+		keys.add(&upper.key_flags, 1);
+		keys.add(reinterpret_cast<const UCHAR*>(&lower.key_length), sizeof(USHORT));
+		keys.add(reinterpret_cast<const UCHAR*>(&upper.key_length), sizeof(USHORT));
+		keys.add(lower.key_data, lower.key_length);
+		keys.add(upper.key_data, upper.key_length);
+	}
+
+	SortedArray<IndexProbe, InlineStorage<IndexProbe, 16> > probes(pool);
+	probes.setSortMode(FB_ARRAY_SORT_MANUAL);
+
+	for (FB_SIZE_T i = 0; i < count; i++)
+	{
+		const UCHAR* ptr = keys.begin() + offsets[i];
+
+		IndexProbe probe;
+		probe.retrieval = retrievals[i];
+		probe.lowerFlags = *ptr++;
+		probe.upperFlags = *ptr++;
+		memcpy(&probe.lowerLength, ptr, sizeof(USHORT));
+		ptr += sizeof(USHORT);
+		memcpy(&probe.upperLength, ptr, sizeof(USHORT));
+		ptr += sizeof(USHORT);
+		probe.lower = ptr;
+		probe.upper = ptr + probe.lowerLength;
+
+		probes.add(probe);
+	}
+
+	probes.sort();
+
+	const IndexRetrieval* const first = retrievals[0];
+	RelationPages* const relPages = first->irb_relation->getPages(tdbb);
+	WIN window(relPages->rel_pg_space_id, -1);
+	window.win_page = relPages->rel_index_root;
+
+	index_desc idx;
+	index_root_page* const rpage = (index_root_page*) CCH_FETCH(tdbb, &window, LCK_read, pag_root);
+
+	if (!BTR_description(tdbb, first->irb_relation, rpage, &idx, first->irb_index))
+	{
+		CCH_RELEASE(tdbb, &window);
+		IBERROR(260);	// msg 260 index unexpectedly deleted
+	}
+
+	const ULONG rootPage = idx.idx_root;
+	CCH_RELEASE(tdbb, &window);
+
+	const bool descending = (idx.idx_flags & idx_descending);
+	btree_page* page = NULL;
+
+	for (const IndexProbe* probe = probes.begin(); probe < probes.end(); probe++)
+	{
+		if (probe > probes.begin() && probe->sameAs(probe[-1]))
+			continue;
+
+		const IndexRetrieval* const retrieval = probe->retrieval;
+		const bool partial = (retrieval->irb_generic & (irb_starting | irb_partial));
+
+		lower.key_flags = probe->lowerFlags;
+		lower.key_length = probe->lowerLength;
+		memcpy(lower.key_data, probe->lower, probe->lowerLength);
+
+		upper.key_flags = probe->upperFlags;
+		upper.key_length = probe->upperLength;
+		memcpy(upper.key_data, probe->upper, probe->upperLength);
+
+		UCHAR* pointer = NULL;
+		USHORT prefix;
+
+		if (page)
+		{
+			// Stay at the current leaf page if the lower key is above its first key,
+			// otherwise matching nodes may still live at the pages to the left
+
+			IndexNode node;
+			node.readNode(page->btr_nodes + page->btr_jump_size, true);
+
+			if (!node.isEndLevel && !node.isEndBucket &&
+				IndexProbe::compareKeys(lower.key_data, lower.key_length,
+										node.data, node.length) > 0)
+			{
+				pointer = find_node_start_point(page, &lower, 0, &prefix, descending, partial);
+
+				if (!pointer && page->btr_sibling)
+				{
+					page = (btree_page*) CCH_HANDOFF(tdbb, &window, page->btr_sibling,
+													 LCK_read, pag_index);
+					pointer = find_node_start_point(page, &lower, 0, &prefix, descending, partial);
+				}
+			}
+
+			if (!pointer)
+			{
+				CCH_RELEASE(tdbb, &window);
+				page = NULL;
+			}
+		}
+
+		if (!page)
+		{
+			// Descend from the index top to the leaf page containing the lower key.
+			// This may involve sibling buckets if splits are in progress.
+
+			window.win_page = rootPage;
+			page = (btree_page*) CCH_FETCH(tdbb, &window, LCK_read, pag_index);
+
+			while (page->btr_level > 0)
+			{
+				const ULONG number = find_page(page, &lower, &idx, NO_VALUE, partial);
+
+				page = (btree_page*) CCH_HANDOFF(tdbb, &window,
+					(number != END_BUCKET) ? number : page->btr_sibling, LCK_read, pag_index);
+			}
+
+			while (!(pointer = find_node_start_point(page, &lower, 0, &prefix, descending, partial)))
+				page = (btree_page*) CCH_HANDOFF(tdbb, &window, page->btr_sibling, LCK_read, pag_index);
+		}
+
+		prefix = IndexNode::computePrefix(upper.key_data, upper.key_length,
+										  lower.key_data, lower.key_length);
+
+		bool skipLowerKey = (retrieval->irb_generic & irb_exclude_lower);
+
+		if (skipLowerKey)
+			skipLowerKey = check_lower_key_skip(pointer, lower, &idx, retrieval);
+
+		while (scan(tdbb, pointer, bitmap, bitmap_and, &idx, retrieval, prefix, &upper,
+					skipLowerKey, lower))
+		{
+			page = (btree_page*) CCH_HANDOFF(tdbb, &window, page->btr_sibling, LCK_read, pag_index);
+			pointer = page->btr_nodes + page->btr_jump_size;
+			prefix = 0;
+		}
+	}
+
+	if (page)
+		CCH_RELEASE(tdbb, &window);
+}
+
+
 UCHAR* BTR_find_leaf(btree_page* bucket, temporary_key* key, UCHAR* value,
 					 USHORT* return_value, bool descending, bool retrieval)
 {
@@ -1009,6 +1335,14 @@ void BTR_insert(thread_db* tdbb, WIN* root_window, index_insertion* insertion)
  **************************************/
 	SET_TDBB(tdbb);
 
+	// Ascending keys go to the rightmost leaf page, try to put them there
+	// without descending from the top of the index
+	if (!insertion->iib_btr_level && append_node(tdbb, insertion))
+	{
+		CCH_RELEASE(tdbb, root_window);
+		return;
+	}
+
 	index_desc* idx = insertion->iib_descriptor;
 	RelationPages* relPages = insertion->iib_relation->getPages(tdbb);
 	WIN window(relPages->rel_pg_space_id, idx->idx_root);
@@ -1519,7 +1853,8 @@ idx_e BTR_make_key(thread_db* tdbb,
 				   const ValueExprNode* const* exprs,
 				   const index_desc* idx,
 				   temporary_key* key,
-				   bool fuzzy)
+				   bool fuzzy,
+				   USHORT first)
 {
 /**************************************
  *
@@ -1530,6 +1865,8 @@ idx_e BTR_make_key(thread_db* tdbb,
  * Functional description
  *	Construct a (possibly) compound search key given a key count,
  *	a vector of value expressions, and a place to put the key.
+ *	If the first segment is not zero, only the tail of the compound
+ *	key starting at that segment is built (used by skip scans).
  *
  **************************************/
 	DSC temp_desc;
@@ -1541,6 +1878,7 @@ idx_e BTR_make_key(thread_db* tdbb,
 	const Database* dbb = tdbb->getDatabase();
 
 	fb_assert(count > 0);
+	fb_assert(first + count <= idx->idx_count);
 	fb_assert(idx != NULL);
 	fb_assert(exprs != NULL);
 	fb_assert(key != NULL);
@@ -1550,7 +1888,7 @@ idx_e BTR_make_key(thread_db* tdbb,
 
 	const bool descending = (idx->idx_flags & idx_descending);
 
-	const index_desc::idx_repeat* tail = idx->idx_rpt;
+	const index_desc::idx_repeat* tail = idx->idx_rpt + first;
 
 	const USHORT keyType = fuzzy ?
 		INTL_KEY_PARTIAL : ((idx->idx_flags & idx_unique) ? INTL_KEY_UNIQUE : INTL_KEY_SORT);
@@ -1579,8 +1917,8 @@ idx_e BTR_make_key(thread_db* tdbb,
 		SSHORT stuff_count = 0;
 		bool is_key_empty = true;
 		USHORT prior_length = 0;
-		USHORT n = 0;
-		for (; n < count; n++, tail++)
+		USHORT n = first;
+		for (; n < first + count; n++, tail++)
 		{
 			for (; stuff_count; --stuff_count)
 			{
@@ -1599,7 +1937,7 @@ idx_e BTR_make_key(thread_db* tdbb,
 			temp.key_flags |= key_empty;
 
 			compress(tdbb, desc, &temp, tail->idx_itype, isNull, descending,
-				(n == count - 1 ?
+				(n == first + count - 1 ?
 					keyType : ((idx->idx_flags & idx_unique) ? INTL_KEY_UNIQUE : INTL_KEY_SORT)));
 
 			if (!(temp.key_flags & key_empty))
@@ -2409,6 +2747,110 @@ static ULONG add_node(thread_db* tdbb,
 }
 
 
+static bool append_node(thread_db* tdbb, index_insertion* insertion)
+{
+/**************************************
+ *
+ *	a p p e n d _ n o d e
+ *
+ **************************************
+ *
+ * Functional description
+ *	Insert a node into the rightmost leaf page remembered by the
+ *	previous insertions. This is possible only if the key is greater
+ *	than every key on that page and the page has room for it,
+ *	otherwise return false to let the caller descend from the top.
+ *
+ **************************************/
+	SET_TDBB(tdbb);
+
+	const index_desc* const idx = insertion->iib_descriptor;
+	RelationPages* const relPages = insertion->iib_relation->getPages(tdbb);
+	const ULONG pageNumber = relPages->getRightLeaf(idx->idx_id);
+
+	if (!pageNumber)
+		return false;
+
+	// The caller holds the index root page, so don't wait for the leaf page
+	// latch here as it would break the top-down latching order. If the page
+	// is busy, just fall back to the regular descent from the top.
+	WIN window(relPages->rel_pg_space_id, pageNumber);
+	btree_page* const bucket = (btree_page*) CCH_FETCH_TIMEOUT(tdbb, &window, LCK_write, pag_undefined, 0);
+
+	if (!bucket)
+		return false;
+
+	// The page could be split, released or even reused since it was remembered
+	if (bucket->btr_header.pag_type != pag_index ||
+		(bucket->btr_header.pag_flags & btr_released) ||
+		bucket->btr_relation != insertion->iib_relation->rel_id ||
+		bucket->btr_id != (UCHAR) (idx->idx_id % 256) ||
+		bucket->btr_level || bucket->btr_sibling)
+	{
+		CCH_RELEASE(tdbb, &window);
+		relPages->setRightLeaf(idx->idx_id, 0);
+		return false;
+	}
+
+	// Restore the last key of the page, starting from the last jump node
+	temporary_key lastKey;
+	lastKey.key_flags = 0;
+	lastKey.key_length = 0;
+
+	UCHAR* pointer = bucket->btr_nodes;
+	UCHAR* nodes = bucket->btr_nodes + bucket->btr_jump_size;
+	IndexJumpNode jumpNode;
+
+	for (UCHAR n = bucket->btr_jump_count; n; n--)
+	{
+		pointer = jumpNode.readJumpNode(pointer);
+		memcpy(lastKey.key_data + jumpNode.prefix, jumpNode.data, jumpNode.length);
+		nodes = (UCHAR*) bucket + jumpNode.offset;
+	}
+
+	bool found = false;
+	IndexNode node;
+
+	while (true)
+	{
+		nodes = node.readNode(nodes, true);
+
+		if (node.isEndLevel || node.isEndBucket)
+			break;
+
+		memcpy(lastKey.key_data + node.prefix, node.data, node.length);
+		lastKey.key_length = node.prefix + node.length;
+		found = true;
+	}
+
+	// An empty page tells nothing about the keys it's supposed to contain
+	const temporary_key* const key = insertion->iib_key;
+	const USHORT length = MIN(key->key_length, lastKey.key_length);
+	const int result = memcmp(key->key_data, lastKey.key_data, length);
+
+	if (!found || result < 0 || (!result && key->key_length <= lastKey.key_length))
+	{
+		CCH_RELEASE(tdbb, &window);
+		return false;
+	}
+
+	temporary_key newKey;
+	newKey.key_flags = 0;
+	newKey.key_length = 0;
+
+	RecordNumber recordNumber(0);
+	BtrPageGCLock lock(tdbb);
+	insertion->iib_dont_gc_lock = &lock;
+
+	if (insert_node(tdbb, &window, insertion, &newKey, &recordNumber, NULL, NULL, false) == NO_SPLIT)
+		return true;
+
+	// The page is full, let the regular insertion split it
+	CCH_RELEASE(tdbb, &window);
+	return false;
+}
+
+
 static void compress(thread_db* tdbb,
 					 const dsc* desc,
 					 temporary_key* key,
@@ -3256,6 +3698,14 @@ static void delete_tree(thread_db* tdbb,
 				down = 0;
 		}
 
+		// The rightmost leaf page could be remembered for appending keys
+		// (see append_node), make sure it's never used after release
+		if (!page->btr_level && !page->btr_sibling)
+		{
+			CCH_MARK(tdbb, &window);
+			page->btr_header.pag_flags |= btr_released;
+		}
+
 		// go through all the sibling pages on this level and release them
 		next = page->btr_sibling;
 		CCH_RELEASE_TAIL(tdbb, &window);
@@ -3306,6 +3756,214 @@ static DSC* eval(thread_db* tdbb, const ValueExprNode* node, DSC* temp, bool* is
 }
 
 
+static bool check_lower_key_skip(UCHAR* pointer, const temporary_key& lower,
+								 const index_desc* idx, const IndexRetrieval* retrieval)
+{
+/**************************************
+ *
+ *	c h e c k _ l o w e r _ k e y _ s k i p
+ *
+ **************************************
+ *
+ * Functional description
+ *	Check whether the node a retrieval starts from matches
+ *	its lower key, so it should be skipped by an exclusive
+ *	lower bound.
+ *
+ **************************************/
+	const bool descending = (idx->idx_flags & idx_descending);
+	const bool partLower = (retrieval->irb_lower_count < idx->idx_count);
+
+	IndexNode node;
+	node.readNode(pointer, true);
+
+	if ((lower.key_length == node.prefix + node.length) ||
+		((lower.key_length <= node.prefix + node.length) && partLower))
+	{
+		const UCHAR* p = node.data, *q = lower.key_data + node.prefix;
+		const UCHAR* const end = lower.key_data + lower.key_length;
+		while (q < end)
+		{
+			if (*p++ != *q++)
+				return false;
+		}
+
+		if ((p < node.data + node.length) && partLower)
+		{
+			// since key length always is multiplier of (STUFF_COUNT + 1) (for partial
+			// compound keys) and we passed lower key completely then p pointed
+			// us to the next segment number and we can use this fact to calculate
+			// how many segments is equal to lower key
+			const USHORT segnum = idx->idx_count - (UCHAR) (descending ? ((*p) ^ -1) : *p);
+
+			if (segnum < retrieval->irb_lower_count)
+				return false;
+		}
+
+		return true;
+	}
+
+	return false;
+}
+
+
+static void evaluate_skip_scan(thread_db* tdbb, const IndexRetrieval* retrieval,
+							   RecordBitmap** bitmap, RecordBitmap* bitmap_and)
+{
+/**************************************
+ *
+ *	e v a l u a t e _ s k i p _ s c a n
+ *
+ **************************************
+ *
+ * Functional description
+ *	Do a skip scan of a compound index with unbound leading segment.
+ *	For every distinct key of the leading segment, scan the range
+ *	defined by the bounds of the remaining segments and then jump
+ *	to the next distinct leading key straight from the index top.
+ *
+ *	The retrieval lower/upper counts include the leading segment,
+ *	its values are not used. Only ascending indices are handled.
+ *
+ **************************************/
+	SET_TDBB(tdbb);
+
+	const index_desc* const desc = &retrieval->irb_desc;
+	const USHORT segCount = desc->idx_count;
+
+	fb_assert(segCount > 1);
+	fb_assert(!(desc->idx_flags & idx_descending));
+
+	// Generate the keys of the remaining segments before we get any pages locked
+
+	temporary_key tailLower, tailUpper;
+	tailLower.key_flags = tailUpper.key_flags = 0;
+	tailLower.key_length = tailUpper.key_length = 0;
+
+	const bool fuzzy = (retrieval->irb_generic & irb_starting);
+	idx_e errorCode = idx_e_ok;
+
+	if (retrieval->irb_upper_count > 1)
+	{
+		errorCode = BTR_make_key(tdbb, retrieval->irb_upper_count - 1,
+								 retrieval->irb_value + segCount + 1, desc, &tailUpper, fuzzy, 1);
+	}
+
+	if (errorCode == idx_e_ok && retrieval->irb_lower_count > 1)
+	{
+		errorCode = BTR_make_key(tdbb, retrieval->irb_lower_count - 1,
+								 retrieval->irb_value + 1, desc, &tailLower, fuzzy, 1);
+	}
+
+	if (errorCode != idx_e_ok)
+	{
+		index_desc temp_idx = *desc; // to avoid constness issues
+		IndexErrorContext context(retrieval->irb_relation, &temp_idx);
+		context.raise(tdbb, errorCode, NULL);
+	}
+
+	RelationPages* relPages = retrieval->irb_relation->getPages(tdbb);
+	WIN window(relPages->rel_pg_space_id, -1);
+	window.win_page = relPages->rel_index_root;
+
+	index_desc idx;
+	index_root_page* const rpage = (index_root_page*) CCH_FETCH(tdbb, &window, LCK_read, pag_root);
+
+	if (!BTR_description(tdbb, retrieval->irb_relation, rpage, &idx, retrieval->irb_index))
+	{
+		CCH_RELEASE(tdbb, &window);
+		IBERROR(260);	// msg 260 index unexpectedly deleted
+	}
+
+	const ULONG rootPage = idx.idx_root;
+	CCH_RELEASE(tdbb, &window);
+
+	// Segment number stored in front of every chunk of the leading segment key
+	const UCHAR leadMarker = (UCHAR) segCount;
+
+	temporary_key seek, lower, upper, found, prior;
+	seek.key_flags = lower.key_flags = upper.key_flags = 0;
+	seek.key_length = 0;
+
+	UCHAR* pointer;
+
+	// Start with the very first key of the index
+	while (find_skip_node(tdbb, &window, rootPage, &idx, &seek, &found, &prior, &pointer))
+	{
+		// Isolate the leading segment of the key found
+
+		USHORT leadLength = 0;
+		while (leadLength < found.key_length && found.key_data[leadLength] == leadMarker)
+			leadLength += STUFF_COUNT + 1;
+
+		leadLength = MIN(leadLength, found.key_length);
+
+		// Prepare the bounds for this leading key. Without an upper bound
+		// for the remaining segments, stop before the next leading key.
+
+		if (leadLength + MAX(tailLower.key_length, tailUpper.key_length) >= MAX_KEY)
+		{
+			CCH_RELEASE(tdbb, &window);
+
+			index_desc temp_idx = *desc; // to avoid constness issues
+			IndexErrorContext context(retrieval->irb_relation, &temp_idx);
+			context.raise(tdbb, idx_e_keytoobig, NULL);
+		}
+
+		memcpy(lower.key_data, found.key_data, leadLength);
+		memcpy(lower.key_data + leadLength, tailLower.key_data, tailLower.key_length);
+		lower.key_length = leadLength + tailLower.key_length;
+
+		memcpy(upper.key_data, found.key_data, leadLength);
+		upper.key_length = leadLength;
+
+		if (retrieval->irb_upper_count > 1 &&
+			(tailUpper.key_length || !(tailUpper.key_flags & key_empty)))
+		{
+			memcpy(upper.key_data + leadLength, tailUpper.key_data, tailUpper.key_length);
+			upper.key_length += tailUpper.key_length;
+		}
+		else
+			upper.key_data[upper.key_length++] = leadMarker - 1;
+
+		// The next leading key starts after all chunks of the current one
+
+		memcpy(seek.key_data, found.key_data, leadLength);
+		seek.key_data[leadLength] = leadMarker;
+		seek.key_length = leadLength + 1;
+
+		// Reposition to the lower bound if the key found is below it
+
+		const USHORT length = MIN(found.key_length, lower.key_length);
+		const int result = memcmp(found.key_data, lower.key_data, length);
+
+		if (result < 0 || (!result && found.key_length < lower.key_length))
+		{
+			CCH_RELEASE(tdbb, &window);
+
+			if (!find_skip_node(tdbb, &window, rootPage, &idx, &lower, &found, &prior, &pointer))
+				break;
+		}
+
+		bool skipLowerKey = (retrieval->irb_generic & irb_exclude_lower);
+		USHORT prefix = IndexNode::computePrefix(upper.key_data, upper.key_length,
+												 prior.key_data, prior.key_length);
+
+		btree_page* page = (btree_page*) window.win_buffer;
+
+		while (scan(tdbb, pointer, bitmap, bitmap_and, &idx, retrieval, prefix, &upper,
+					skipLowerKey, lower))
+		{
+			page = (btree_page*) CCH_HANDOFF(tdbb, &window, page->btr_sibling, LCK_read, pag_index);
+			pointer = page->btr_nodes + page->btr_jump_size;
+			prefix = 0;
+		}
+
+		CCH_RELEASE(tdbb, &window);
+	}
+}
+
+
 static ULONG fast_load(thread_db* tdbb,
 					   IndexCreation& creation,
 					   SelectivityList& selectivity)
@@ -4650,6 +5308,83 @@ static ULONG find_page(btree_page* bucket, const temporary_key* key,
 }
 
 
+static bool find_skip_node(thread_db* tdbb, WIN* window, ULONG rootPage, const index_desc* idx,
+						   const temporary_key* key, temporary_key* found, temporary_key* prior,
+						   UCHAR** position)
+{
+/**************************************
+ *
+ *	f i n d _ s k i p _ n o d e
+ *
+ **************************************
+ *
+ * Functional description
+ *	Walk down the index to the first leaf node with key greater
+ *	than or equal to the given one. Return the full key of that
+ *	node and of its predecessor on the page, leaving the leaf page
+ *	fetched and the node position in the bucket. If we've hit the
+ *	end of the index level, release the page and return false.
+ *
+ **************************************/
+	window->win_page = rootPage;
+	btree_page* page = (btree_page*) CCH_FETCH(tdbb, window, LCK_read, pag_index);
+
+	while (page->btr_level > 0)
+	{
+		const ULONG number = find_page(page, key, idx, NO_VALUE, true);
+
+		page = (btree_page*) CCH_HANDOFF(tdbb, window,
+			(number != END_BUCKET) ? number : page->btr_sibling, LCK_read, pag_index);
+	}
+
+	while (true)
+	{
+		const UCHAR* const endPointer = (UCHAR*) page + page->btr_length;
+		UCHAR* pointer = page->btr_nodes + page->btr_jump_size;
+
+		found->key_length = 0;
+
+		IndexNode node;
+
+		while (true)
+		{
+			UCHAR* const nodePointer = pointer;
+			pointer = node.readNode(pointer, true);
+
+			// Check if pointer is still valid
+			if (pointer > endPointer)
+				BUGCHECK(204);	// msg 204 index inconsistent
+
+			if (node.isEndLevel)
+			{
+				CCH_RELEASE(tdbb, window);
+				return false;
+			}
+
+			if (node.isEndBucket)
+				break;
+
+			memcpy(prior->key_data, found->key_data, found->key_length);
+			prior->key_length = found->key_length;
+
+			memcpy(found->key_data + node.prefix, node.data, node.length);
+			found->key_length = node.prefix + node.length;
+
+			const USHORT length = MIN(found->key_length, key->key_length);
+			const int result = memcmp(found->key_data, key->key_data, length);
+
+			if (result > 0 || (!result && found->key_length >= key->key_length))
+			{
+				*position = nodePointer;
+				return true;
+			}
+		}
+
+		page = (btree_page*) CCH_HANDOFF(tdbb, window, page->btr_sibling, LCK_read, pag_index);
+	}
+}
+
+
 static contents garbage_collect(thread_db* tdbb, WIN* window, ULONG parent_number)
 {
 /**************************************
@@ -5312,7 +6047,8 @@ static ULONG insert_node(thread_db* tdbb,
 						 temporary_key* new_key,
 						 RecordNumber* new_record_number,
 						 ULONG* original_page,
-						 ULONG* sibling_page)
+						 ULONG* sibling_page,
+						 bool splitAllowed)
 {
 /**************************************
  *
@@ -5325,6 +6061,8 @@ static ULONG insert_node(thread_db* tdbb,
  *  If this isn't the right bucket, return NO_VALUE.
  *  If it splits, return the split page number and
  *	leading string.  This is the workhorse for add_node.
+ *  If split is not allowed and the node doesn't fit,
+ *  return NO_VALUE leaving the page untouched.
  *
  **************************************/
 
@@ -5625,6 +6363,13 @@ static ULONG insert_node(thread_db* tdbb,
 		bucket->btr_prefix_total = newBucket->btr_prefix_total;
 		bucket->btr_length = newBucket->btr_length + jumpersNewSize - jumpersOriginalSize;
 
+		// Remember the rightmost leaf page to append next ascending keys there directly
+		if (leafPage && endOfPage && !bucket->btr_sibling)
+		{
+			insertion->iib_relation->getPages(tdbb)->setRightLeaf(idx->idx_id,
+				window->win_page.getPageNum());
+		}
+
 		CCH_RELEASE(tdbb, window);
 
 		jumpNodes->clear();
@@ -5632,6 +6377,20 @@ static ULONG insert_node(thread_db* tdbb,
 		return NO_SPLIT;
 	}
 
+	if (!splitAllowed)
+	{
+		if (fragmentedOffset)
+		{
+			IndexJumpNode* walkJumpNode = jumpNodes->begin();
+			for (size_t i = 0; i < jumpNodes->getCount(); i++)
+				delete[] walkJumpNode[i].data;
+		}
+
+		jumpNodes->clear();
+
+		return NO_VALUE_PAGE;
+	}
+
 	// We've a bucket split in progress.  We need to determine the split point.
 	// Set it halfway through the page, unless we are at the end of the page,
 	// in which case put only the new node on the new page.  This will ensure
@@ -5894,6 +6653,13 @@ static ULONG insert_node(thread_db* tdbb,
 	if (original_page)
 		*original_page = window->win_page.getPageNum();
 
+	// The split page became the rightmost leaf
+	if (leafPage && !right_sibling)
+	{
+		insertion->iib_relation->getPages(tdbb)->setRightLeaf(idx->idx_id,
+			split_window.win_page.getPageNum());
+	}
+
 	// now we need to go to the right sibling page and update its
 	// left sibling pointer to point to the newly split page
 	if (right_sibling)
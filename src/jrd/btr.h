@@ -67,6 +67,8 @@ struct index_desc
 	ValueExprNode* idx_expression;			// node tree for indexed expresssion
 	dsc		idx_expression_desc;			// descriptor for expression result
 	JrdStatement* idx_expression_statement;	// stored statement for expression evaluation
+	BoolExprNode* idx_condition;			// node tree for partial index condition
+	JrdStatement* idx_condition_statement;	// stored statement for condition evaluation
 	// This structure should exactly match IRTD structure for current ODS
 	struct idx_repeat
 	{
@@ -116,6 +118,7 @@ const int idx_in_progress	= 4;
 const int idx_foreign		= 8;
 const int idx_primary		= 16;
 const int idx_expressn		= 32;
+const int idx_condition		= 64;
 
 // these flags are for idx_runtime_flags
 
@@ -227,6 +230,7 @@ const int irb_ignore_null_value_key  = 8;	// if lower bound is specified and upp
 const int irb_descending	= 16;			// Base index uses descending order
 const int irb_exclude_lower	= 32;			// exclude lower bound keys while scanning index
 const int irb_exclude_upper	= 64;			// exclude upper bound keys while scanning index
+const int irb_skip_scan	= 128;				// leading segment is unbound, probe each distinct leading key
 
 typedef Firebird::HalfStaticArray<float, 4> SelectivityList;
 
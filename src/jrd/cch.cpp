@@ -886,8 +886,15 @@ void CCH_fetch_page(thread_db* tdbb, WIN* window, const bool read_shadow)
 			Database *dbb = tdbb->getDatabase();
 			int retryCount = 0;
 
-			while (!PIO_read(tdbb, file, bdb, page, status))
+			while (true)
 	 		{
+				{	// scope
+					RuntimeStatistics::WaitTimer readTimer(tdbb, RuntimeStatistics::TIME_PAGE_READS);
+
+					if (PIO_read(tdbb, file, bdb, page, status))
+						break;
+				}
+
 				if (isTempPage || !read_shadow)
 					return false;
 
@@ -1905,6 +1912,55 @@ bool set_diff_page(thread_db* tdbb, BufferDesc* bdb)
 }
 
 
+void CCH_read_ahead(thread_db* tdbb, USHORT pageSpaceId, const ULONG* pages, FB_SIZE_T count)
+{
+/**************************************
+ *
+ *	C C H _ r e a d _ a h e a d
+ *
+ **************************************
+ *
+ * Functional description
+ *	Given a vector of pages going to be fetched soon, let
+ *	the file system read them in advance. Pages are put in
+ *	order and adjacent ones are requested all together.
+ *
+ **************************************/
+	SET_TDBB(tdbb);
+	Database* const dbb = tdbb->getDatabase();
+
+	// While the database is locked by nbackup, pages may be read from
+	// the difference file rather than from the database file
+
+	if (dbb->dbb_backup_manager->getState() != Ods::hdr_nbak_normal)
+		return;
+
+	const PageSpace* const pageSpace = dbb->dbb_page_manager.findPageSpace(pageSpaceId);
+
+	if (!pageSpace || !pageSpace->file)
+		return;
+
+	PagesArray sorted;
+
+	for (const ULONG* const end = pages + count; pages < end; pages++)
+	{
+		if (*pages)
+			sorted.add(*pages);
+	}
+
+	for (FB_SIZE_T i = 0; i < sorted.getCount();)
+	{
+		const ULONG first = sorted[i];
+		ULONG last = first;
+
+		while (++i < sorted.getCount() && (ULONG) sorted[i] <= last + 1)
+			last = sorted[i];
+
+		PIO_prefetch(tdbb, pageSpace->file, first, last - first + 1);
+	}
+}
+
+
 void CCH_release(thread_db* tdbb, WIN* window, const bool release_tail)
 {
 /**************************************
@@ -4938,6 +4994,7 @@ static bool write_page(thread_db* tdbb, BufferDesc* bdb, FbStatusVector* const s
 	if (true)
 	{
 		tdbb->bumpStats(RuntimeStatistics::PAGE_WRITES);
+		RuntimeStatistics::WaitTimer writeTimer(tdbb, RuntimeStatistics::TIME_PAGE_WRITES);
 
 		// write out page to main database file, and to any
 		// shadows, making a special case of the header page
@@ -5203,10 +5260,20 @@ void BufferControl::destroy(BufferControl* bcb)
 
 bool BufferDesc::addRef(thread_db* tdbb, SyncType syncType, int wait)
 {
-	if (wait == 1)
-		bdb_syncPage.lock(NULL, syncType, FB_FUNCTION);
-	else if (!bdb_syncPage.lock(NULL, syncType, FB_FUNCTION, -wait * 1000))
-		return false;
+	// Don't time latches granted immediately, only actual waits are counted
+
+	if (!bdb_syncPage.lockConditional(syncType, FB_FUNCTION))
+	{
+		if (!wait)
+			return false;
+
+		RuntimeStatistics::WaitTimer latchTimer(tdbb, RuntimeStatistics::TIME_LATCH_WAITS);
+
+		if (wait == 1)
+			bdb_syncPage.lock(NULL, syncType, FB_FUNCTION);
+		else if (!bdb_syncPage.lock(NULL, syncType, FB_FUNCTION, -wait * 1000))
+			return false;
+	}
 
 	++bdb_use_count;
 
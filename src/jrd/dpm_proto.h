@@ -53,6 +53,7 @@ namespace Ods
 	struct data_page;
 }
 
+bool	DPM_all_swept(Jrd::thread_db*, Jrd::jrd_rel*, ULONG);
 Ods::pag* DPM_allocate(Jrd::thread_db*, Jrd::win*);
 void	DPM_backout(Jrd::thread_db*, Jrd::record_param*);
 void	DPM_backout_mark(Jrd::thread_db*, Jrd::record_param*, const Jrd::jrd_tra*);
@@ -358,86 +358,29 @@ void EventManager::cancelEvents(SLONG request_id)
 }
 
 
-void EventManager::postEvent(USHORT length, const TEXT* string, USHORT count)
+void EventManager::postEvents(const PostedEvent* events, FB_SIZE_T count)
 {
 /**************************************
  *
- *	p o s t E v e n t
+ *	p o s t E v e n t s
  *
  **************************************
  *
  * Functional description
- *	Post an event.
+ *	Post a set of events and deliver them at once.
+ *	The shared region is acquired only once for
+ *	all events posted by a transaction.
  *
  **************************************/
 	acquire_shmem();
 
-	evnt* const event = find_event(length, string);
-
-	if (event)
-	{
-		event->evnt_count += count;
-		srq* event_srq;
-		SRQ_LOOP(event->evnt_interests, event_srq)
-		{
-			req_int* const interest = (req_int*) ((UCHAR*) event_srq - offsetof(req_int, rint_interests));
-			if (interest->rint_request)
-			{
-				evt_req* const request = (evt_req*) SRQ_ABS_PTR(interest->rint_request);
-
-				if (interest->rint_count <= event->evnt_count)
-				{
-					prb* const process = (prb*) SRQ_ABS_PTR(request->req_process);
-					process->prb_flags |= PRB_wakeup;
-				}
-			}
-		}
-	}
-
-	release_shmem();
-}
-
+	for (const PostedEvent* const end = events + count; events < end; events++)
+		post_event(events->length, events->name, events->count);
 
-void EventManager::deliverEvents()
-{
-/**************************************
- *
- *	d e l i v e r E v e n t s
- *
- **************************************
- *
- * Functional description
- *	Post an event (step 2).
- *
- *  This routine is called by DFW_perform_post_commit_work()
- *  once all pending events are prepared
- *  for delivery with postEvent().
- *
- **************************************/
-	acquire_shmem();
-
-	// Deliver requests for posted events
-
-	bool flag = true;
-
-	while (flag)
+	if (!post_processes())
 	{
-		flag = false;
-		srq* event_srq;
-		SRQ_LOOP (m_sharedMemory->getHeader()->evh_processes, event_srq)
-		{
-			prb* const process = (prb*) ((UCHAR*) event_srq - offsetof(prb, prb_processes));
-			if (process->prb_flags & PRB_wakeup)
-			{
-				if (!post_process(process))
-				{
-					release_shmem();
-					(Arg::Gds(isc_random) << "post_process() failed").raise();
-				}
-				flag = true;
-				break;
-			}
-		}
+		release_shmem();
+		(Arg::Gds(isc_random) << "post_process() failed").raise();
 	}
 
 	release_shmem();
@@ -1115,6 +1058,43 @@ void EventManager::mutex_bugcheck(const TEXT* string, int mutex_state)
 }
 
 
+void EventManager::post_event(USHORT length, const TEXT* string, USHORT count)
+{
+/**************************************
+ *
+ *	p o s t _ e v e n t
+ *
+ **************************************
+ *
+ * Functional description
+ *	Count an event and mark the processes waiting
+ *	for it to be woken up.
+ *
+ **************************************/
+	evnt* const event = find_event(length, string);
+
+	if (event)
+	{
+		event->evnt_count += count;
+		srq* event_srq;
+		SRQ_LOOP(event->evnt_interests, event_srq)
+		{
+			req_int* const interest = (req_int*) ((UCHAR*) event_srq - offsetof(req_int, rint_interests));
+			if (interest->rint_request)
+			{
+				evt_req* const request = (evt_req*) SRQ_ABS_PTR(interest->rint_request);
+
+				if (interest->rint_count <= event->evnt_count)
+				{
+					prb* const process = (prb*) SRQ_ABS_PTR(request->req_process);
+					process->prb_flags |= PRB_wakeup;
+				}
+			}
+		}
+	}
+}
+
+
 bool EventManager::post_process(prb* process)
 {
 /**************************************
@@ -1133,6 +1113,32 @@ bool EventManager::post_process(prb* process)
 }
 
 
+bool EventManager::post_processes()
+{
+/**************************************
+ *
+ *	p o s t _ p r o c e s s e s
+ *
+ **************************************
+ *
+ * Functional description
+ *	Wakeup all processes marked for wakeup.
+ *	Waking up doesn't change the list of
+ *	processes, so a single pass is enough.
+ *
+ **************************************/
+	srq* event_srq;
+	SRQ_LOOP (m_sharedMemory->getHeader()->evh_processes, event_srq)
+	{
+		prb* const process = (prb*) ((UCHAR*) event_srq - offsetof(prb, prb_processes));
+		if ((process->prb_flags & PRB_wakeup) && !post_process(process))
+			return false;
+	}
+
+	return true;
+}
+
+
 void EventManager::probe_processes()
 {
 /**************************************
@@ -52,8 +52,15 @@ public:
 
 	SLONG queEvents(SLONG, USHORT, const UCHAR*, Firebird::IEventCallback*);
 	void cancelEvents(SLONG);
-	void postEvent(USHORT, const TEXT*, USHORT);
-	void deliverEvents();
+	// Event posted at transaction commit
+	struct PostedEvent
+	{
+		const TEXT* name;
+		USHORT length;
+		USHORT count;
+	};
+
+	void postEvents(const PostedEvent*, FB_SIZE_T);
 
 	bool initialize(Firebird::SharedMemoryBase*, bool);
 	void mutexBug(int osErrorCode, const char* text);
@@ -76,7 +83,9 @@ private:
 	req_int* historical_interest(ses*, SLONG);
 	void insert_tail(srq*, srq*);
 	evnt* make_event(USHORT, const TEXT*);
+	void post_event(USHORT, const TEXT*, USHORT);
 	bool post_process(prb*);
+	bool post_processes();
 	void probe_processes();
 	void release_shmem();
 	void remove_que(srq*);
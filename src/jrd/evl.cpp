@@ -244,9 +244,29 @@ RecordBitmap** EVL_bitmap(thread_db* tdbb, const InversionNode* node, RecordBitm
 
 	case InversionNode::TYPE_IN:
 		{
-			RecordBitmap** inv_bitmap = EVL_bitmap(tdbb, node->node1, bitmap_and);
-			BTR_evaluate(tdbb, node->node2->retrieval, inv_bitmap, bitmap_and);
-			return inv_bitmap;
+			// Collect all the retrievals of the list, so that
+			// the index could be probed in the key order
+
+			HalfStaticArray<const IndexRetrieval*, OPT_STATIC_ITEMS> retrievals;
+			const InversionNode* list = node;
+
+			for (; list->type == InversionNode::TYPE_IN; list = list->node1)
+				retrievals.add(list->node2->retrieval);
+
+			if (list->type != InversionNode::TYPE_INDEX)
+			{
+				RecordBitmap** inv_bitmap = EVL_bitmap(tdbb, node->node1, bitmap_and);
+				BTR_evaluate(tdbb, node->node2->retrieval, inv_bitmap, bitmap_and);
+				return inv_bitmap;
+			}
+
+			retrievals.add(list->retrieval);
+
+			impure_inversion* impure = tdbb->getRequest()->getImpure<impure_inversion>(list->impure);
+			RecordBitmap::reset(impure->inv_bitmap);
+			BTR_evaluate_list(tdbb, retrievals.getCount(), retrievals.begin(),
+							  &impure->inv_bitmap, bitmap_and);
+			return &impure->inv_bitmap;
 		}
 
 	case InversionNode::TYPE_DBKEY:
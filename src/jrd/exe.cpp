@@ -920,6 +920,12 @@ void EXE_start(thread_db* tdbb, jrd_req* request, jrd_tra* transaction)
 	request->req_src_line = 0;
 	request->req_src_column = 0;
 
+	if (tdbb->getDatabase()->dbb_config->getProfileRecordSources())
+	{
+		request->req_flags |= req_profile;
+		request->req_profile_run++;
+	}
+
 	TRA_setup_request_snapshot(tdbb, request);
 
 	execute_looper(tdbb, request, transaction,
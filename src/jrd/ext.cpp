@@ -65,18 +65,14 @@
 // NS: in VS2003 these only work with static CRT
 extern "C" {
 int __cdecl _fseeki64(FILE*, __int64, int);
-__int64 __cdecl _ftelli64(FILE*);
 }
 #endif
 
 #ifdef WIN_NT
-#define FTELL64 _ftelli64
 #define FSEEK64 _fseeki64
 #elif defined(LSB_BUILD)
-#define FTELL64 ftello64
 #define FSEEK64 fseeko64
 #else
-#define FTELL64 ftello
 #define FSEEK64 fseeko
 #endif
 
@@ -124,6 +120,10 @@ namespace {
 #endif
 	static const char* const FOPEN_READ_ONLY	= "rb";
 
+	// Size of stream buffer of external file being scanned. Default stdio buffer
+	// is too small for big files and makes a read system call every few records.
+	const size_t EXT_BUFFER_SIZE = 256 * 1024;
+
 	FILE* ext_fopen(Database* dbb, ExternalFile* ext_file)
 	{
 		const char* file_name = ext_file->ext_filename;
@@ -156,6 +156,18 @@ namespace {
 
 		return ext_file->ext_ifi;
 	}
+
+	void ext_fclose(ExternalFile* ext_file)
+	{
+		if (ext_file->ext_ifi)
+		{
+			fclose(ext_file->ext_ifi);
+			ext_file->ext_ifi = NULL;
+		}
+
+		delete[] ext_file->ext_buffer;
+		ext_file->ext_buffer = NULL;
+	}
 } // namespace
 
 
@@ -197,10 +209,7 @@ double EXT_cardinality(thread_db* tdbb, jrd_rel* relation)
 		}
 
 		if (must_close)
-		{
-			fclose(file->ext_ifi);
-			file->ext_ifi = NULL;
-		}
+			ext_fclose(file);
 
 		const Format* const format = MET_current(tdbb, relation);
 		fb_assert(format && format->fmt_length);
@@ -310,6 +319,8 @@ ExternalFile* EXT_file(jrd_rel* relation, const TEXT* file_name) //, bid* descri
 	strcpy(file->ext_filename, file_name);
 	file->ext_flags = 0;
 	file->ext_ifi = NULL;
+	file->ext_buffer = NULL;
+	file->ext_position = 0;
 
 	return file;
 }
@@ -330,11 +341,7 @@ void EXT_fini(jrd_rel* relation, bool close_only)
 	if (relation->rel_file)
 	{
 		ExternalFile* file = relation->rel_file;
-		if (file->ext_ifi)
-		{
-			fclose(file->ext_ifi);
-			file->ext_ifi = NULL;
-		}
+		ext_fclose(file);
 
 		// before zeroing out the rel_file we need to deallocate the memory
 		if (!close_only)
@@ -380,21 +387,10 @@ bool EXT_get(thread_db* tdbb, record_param* rpb, FB_UINT64& position)
 	// call it if it is not necessary. Note that we must flush file buffer if we
 	// do read after write
 
-	bool doSeek = false;
-	if (!(file->ext_flags & EXT_last_read))
-	{
-		doSeek = true;
-	}
-	else
-	{
-		SINT64 offset = FTELL64(file->ext_ifi);
-		if (offset < 0)
-		{
-			ERR_post(Arg::Gds(isc_io_error) << STRINGIZE(FTELL64) << Arg::Str(file->ext_filename) <<
-					 Arg::Gds(isc_io_read_err) << SYS_ERR(errno));
-		}
-		doSeek = (static_cast<FB_UINT64>(offset) != position);
-	}
+	// After a read the file pointer is known to be right after the record
+	// read, thus there is no need to ask the stream for it
+
+	const bool doSeek = !(file->ext_flags & EXT_last_read) || file->ext_position != position;
 
 	// reset both flags cause we are going to move the file pointer
 	file->ext_flags &= ~(EXT_last_write | EXT_last_read);
@@ -414,6 +410,7 @@ bool EXT_get(thread_db* tdbb, record_param* rpb, FB_UINT64& position)
 	}
 
 	position += l;
+	file->ext_position = position;
 	file->ext_flags |= EXT_last_read;
 
 	// Loop thru fields setting missing fields to either blanks/zeros or the missing value
@@ -479,8 +476,24 @@ void EXT_open(Database* dbb, ExternalFile* file)
  *	Open a record stream for an external file.
  *
  **************************************/
-	if (!file->ext_ifi) {
+	if (!file->ext_ifi)
+	{
 		ext_fopen(dbb, file);
+
+		// Set up a large stream buffer as the file is likely to be scanned
+		// sequentially. It should be done before any other operation.
+
+		file->ext_buffer = FB_NEW_POOL(*dbb->dbb_permanent) char[EXT_BUFFER_SIZE];
+
+		if (setvbuf(file->ext_ifi, file->ext_buffer, _IOFBF, EXT_BUFFER_SIZE) != 0)
+		{
+			delete[] file->ext_buffer;
+			file->ext_buffer = NULL;
+		}
+
+#if defined(POSIX_FADV_SEQUENTIAL) && !defined(WIN_NT)
+		os_utils::posix_fadvise(fileno(file->ext_ifi), 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
 	}
 }
 
@@ -611,9 +624,6 @@ void EXT_tra_detach(ExternalFile* file, jrd_tra*)
  **************************************/
 
 	file->ext_tra_cnt--;
-	if (!file->ext_tra_cnt && file->ext_ifi)
-	{
-		fclose(file->ext_ifi);
-		file->ext_ifi = NULL;
-	}
+	if (!file->ext_tra_cnt)
+		ext_fclose(file);
 }
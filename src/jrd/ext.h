@@ -36,6 +36,8 @@ public:
 	USHORT	ext_flags;			// Misc and cruddy flags
 	USHORT	ext_tra_cnt;		// How many transactions used the file
 	FILE*	ext_ifi;			// Internal file identifier
+	char*	ext_buffer;			// Stream buffer of the file opened for scan
+	FB_UINT64	ext_position;	// File position after the last read
 	char	ext_filename[1];
 };
 
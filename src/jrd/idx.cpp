@@ -406,6 +406,16 @@ void IDX_create_index(thread_db* tdbb,
 		{
 			Record* record = stack.pop();
 
+			// records not satisfying the partial index condition are not indexed
+
+			if (!BTR_check_condition(tdbb, idx, record))
+			{
+				if (record != gc_record)
+					delete record;
+
+				continue;
+			}
+
 			result = BTR_key(tdbb, relation, record, idx, &key, false);
 
 			if (result == idx_e_ok)
@@ -749,6 +759,10 @@ void IDX_garbage_collect(thread_db* tdbb, record_param* rpb, RecordStack& going,
 			{
 				Record* const rec1 = stack1.object();
 
+				// record was not indexed by the partial index
+				if (!BTR_check_condition(tdbb, &idx, rec1))
+					continue;
+
 				idx_e result = BTR_key(tdbb, rpb->rpb_relation, rec1, &idx, &key1, false);
 				if (result != idx_e_ok)
 				{
@@ -766,6 +780,9 @@ void IDX_garbage_collect(thread_db* tdbb, record_param* rpb, RecordStack& going,
 				{
 					Record* const rec2 = stack2.object();
 
+					if (!BTR_check_condition(tdbb, &idx, rec2))
+						continue;
+
 					result = BTR_key(tdbb, rpb->rpb_relation, rec2, &idx, &key2, false);
 					if (result != idx_e_ok)
 					{
@@ -789,6 +806,9 @@ void IDX_garbage_collect(thread_db* tdbb, record_param* rpb, RecordStack& going,
 				{
 					Record* const rec3 = stack3.object();
 
+					if (!BTR_check_condition(tdbb, &idx, rec3))
+						continue;
+
 					result = BTR_key(tdbb, rpb->rpb_relation, rec3, &idx, &key2, false);
 					if (result != idx_e_ok)
 					{
@@ -860,6 +880,10 @@ void IDX_modify(thread_db* tdbb,
 		IndexErrorContext context(new_rpb->rpb_relation, &idx);
 		idx_e error_code;
 
+		// new version doesn't belong to the partial index
+		if (!BTR_check_condition(tdbb, &idx, new_rpb->rpb_record))
+			continue;
+
 		if ((error_code = BTR_key(tdbb, new_rpb->rpb_relation,
 				new_rpb->rpb_record, &idx, &key1, false)))
 		{
@@ -867,14 +891,16 @@ void IDX_modify(thread_db* tdbb,
 			context.raise(tdbb, error_code, new_rpb->rpb_record);
 		}
 
-		if ((error_code = BTR_key(tdbb, org_rpb->rpb_relation,
+		const bool org_indexed = BTR_check_condition(tdbb, &idx, org_rpb->rpb_record);
+
+		if (org_indexed && (error_code = BTR_key(tdbb, org_rpb->rpb_relation,
 				org_rpb->rpb_record, &idx, &key2, false)))
 		{
 			CCH_RELEASE(tdbb, &window);
 			context.raise(tdbb, error_code, org_rpb->rpb_record);
 		}
 
-		if (!keysEqual(&key1, &key2))
+		if (!org_indexed || !keysEqual(&key1, &key2))
 		{
 			if ((error_code = insert_key(tdbb, new_rpb->rpb_relation, new_rpb->rpb_record,
 										 transaction, &window, &insertion, context)))
@@ -1081,6 +1107,9 @@ void IDX_store(thread_db* tdbb, record_param* rpb, jrd_tra* transaction)
 		IndexErrorContext context(rpb->rpb_relation, &idx);
 		idx_e error_code;
 
+		if (!BTR_check_condition(tdbb, &idx, rpb->rpb_record))
+			continue;
+
 		if ( (error_code = BTR_key(tdbb, rpb->rpb_relation, rpb->rpb_record, &idx, &key, false)) )
 		{
 			CCH_RELEASE(tdbb, &window);
@@ -1226,9 +1255,11 @@ static idx_e check_duplicates(thread_db* tdbb,
 
 			// check the values of the fields in the record being inserted with the
 			// record retrieved -- for unique indexes the insertion index and the
-			// record index are the same, but for foreign keys they are different
+			// record index are the same, but for foreign keys they are different.
+			// Record versions left outside of a partial index are not duplicates.
 
-			if (cmpRecordKeys(tdbb, rpb.rpb_record, relation_1, insertion_idx,
+			if (BTR_check_condition(tdbb, insertion_idx, rpb.rpb_record) &&
+				cmpRecordKeys(tdbb, rpb.rpb_record, relation_1, insertion_idx,
 							  record, relation_2, record_idx))
 			{
 				// When check foreign keys in snapshot or read consistency transaction, 
@@ -1647,6 +1678,12 @@ static void release_index_block(thread_db* tdbb, IndexBlock* index_block)
 	index_block->idb_expression = NULL;
 	MOVE_CLEAR(&index_block->idb_expression_desc, sizeof(dsc));
 
+	if (index_block->idb_condition_statement)
+		index_block->idb_condition_statement->release(tdbb);
+
+	index_block->idb_condition_statement = NULL;
+	index_block->idb_condition = NULL;
+
 	LCK_release(tdbb, index_block->idb_lock);
 }
 
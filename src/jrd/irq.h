@@ -84,6 +84,7 @@ enum irq_type_t
 
 	irq_c_exp_index,		// create expression index
 	irq_l_exp_index,		// lookup expression index
+	irq_l_cond_index,		// lookup partial index condition
 
 	irq_l_rel_id,			// lookup relation id
 	irq_l_procedure,		// lookup procedure name
@@ -132,6 +132,7 @@
 #include "../jrd/DebugInterface.h"
 #include "../jrd/CryptoManager.h"
 #include "../jrd/DbCreators.h"
+#include "../jrd/BlockRanges.h"
 
 #include "../dsql/dsql.h"
 #include "../dsql/dsql_proto.h"
@@ -1841,6 +1842,10 @@ JAttachment* JProvider::internalAttach(CheckStatusWrapper* user_status, const ch
 				dbb->dbb_tip_cache = FB_NEW_POOL(*dbb->dbb_permanent) TipCache(dbb);
 				dbb->dbb_tip_cache->initializeTpc(tdbb);
 
+				// Block range summaries are valid only while the database is owned by this process
+				if (dbb->dbb_flags & DBB_shared)
+					dbb->dbb_block_ranges = FB_NEW_POOL(*dbb->dbb_permanent) BlockRanges(*dbb->dbb_permanent);
+
 				// linger
 				dbb->dbb_linger_seconds = MET_get_linger(tdbb);
 
@@ -3150,6 +3155,9 @@ JAttachment* JProvider::createDatabase(CheckStatusWrapper* user_status, const ch
 			dbb->dbb_tip_cache = FB_NEW_POOL(*dbb->dbb_permanent) TipCache(dbb);
 			dbb->dbb_tip_cache->initializeTpc(tdbb);
 
+			if (dbb->dbb_flags & DBB_shared)
+				dbb->dbb_block_ranges = FB_NEW_POOL(*dbb->dbb_permanent) BlockRanges(*dbb->dbb_permanent);
+
 			// Init complete - we can release dbInitMutex
 			dbb->dbb_flags &= ~(DBB_new | DBB_creating);
 			guardDbInit.leave();
@@ -7832,6 +7840,8 @@ bool JRD_shutdown_database(Database* dbb, const unsigned flags)
 #endif
 		if (flags & SHUT_DBB_RELEASE_POOLS)
 			TRA_update_counters(tdbb, dbb);
+
+		TRA_release_reserved_ids(tdbb, dbb);
 	}
 	catch (const Exception&)
 	{
@@ -307,6 +307,8 @@ public:
 	ValueExprNode* idb_expression;			// node tree for index expression
 	JrdStatement* idb_expression_statement;	// statement for index expression evaluation
 	dsc			idb_expression_desc;		// descriptor for expression result
+	BoolExprNode* idb_condition;			// node tree for partial index condition
+	JrdStatement* idb_condition_statement;	// statement for partial index condition evaluation
 	Lock*		idb_lock;					// lock to synchronize changes to index
 	USHORT		idb_id;
 };
@@ -44,6 +44,8 @@ NAME("RDB$COLLATION_NAME", nam_collate_name)
 NAME("RDB$COMPLEX_NAME", nam_cpx_name)
 NAME("RDB$COMPUTED_BLR", nam_computed)
 NAME("RDB$COMPUTED_SOURCE", nam_c_source)
+NAME("RDB$CONDITION_BLR", nam_cond_blr)
+NAME("RDB$CONDITION_SOURCE", nam_cond_source)
 NAME("RDB$CONSTRAINT_NAME", nam_con_name)
 NAME("RDB$CONSTRAINT_TYPE", nam_con_type)
 NAME("RDB$CONST_NAME_UQ", nam_con_uq)
@@ -305,7 +307,9 @@ NAME("MON$FRAGMENT_READS", nam_mon_fragment_reads)
 NAME("MON$GARBAGE_COLLECTION", nam_mon_gc)
 NAME("MON$IO_STATS", nam_mon_io_stats)
 NAME("MON$ISOLATION_MODE", nam_mon_iso_mode)
+NAME("MON$LATCH_WAIT_TIME", nam_mon_latch_wait_time)
 NAME("MON$LOCK_TIMEOUT", nam_mon_lock_timeout)
+NAME("MON$LOCK_WAIT_TIME", nam_mon_lock_wait_time)
 NAME("MON$MAX_MEMORY_USED", nam_mon_max_used)
 NAME("MON$MAX_MEMORY_ALLOCATED", nam_mon_max_alloc)
 NAME("MON$MEMORY_USAGE", nam_mon_mem_usage)
@@ -328,7 +332,9 @@ NAME("MON$PACKAGE_NAME", nam_mon_pkg_name)
 NAME("MON$PAGE_BUFFERS", nam_mon_page_bufs)
 NAME("MON$PAGE_FETCHES", nam_mon_page_fetches)
 NAME("MON$PAGE_MARKS", nam_mon_page_marks)
+NAME("MON$PAGE_READ_TIME", nam_mon_page_read_time)
 NAME("MON$PAGE_READS", nam_mon_page_reads)
+NAME("MON$PAGE_WRITE_TIME", nam_mon_page_write_time)
 NAME("MON$PAGE_WRITES", nam_mon_page_writes)
 NAME("MON$PAGES", nam_mon_pages)
 NAME("MON$RECORD_BACKOUTS", nam_mon_rec_backouts)
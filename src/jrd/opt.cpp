@@ -90,6 +90,7 @@
 #include "../jrd/DbCreators.h"
 
 #include "../jrd/Optimizer.h"
+#include "../jrd/BlockRanges.h"
 #include "../dsql/BoolNodes.h"
 #include "../dsql/ExprNodes.h"
 #include "../dsql/StmtNodes.h"
@@ -332,6 +333,7 @@ static SLONG decompose(thread_db* tdbb, BoolExprNode* boolNode, BoolExprNodeStac
 	CompilerScratch* csb);
 static USHORT distribute_equalities(BoolExprNodeStack& org_stack, CompilerScratch* csb,
 	USHORT base_count);
+static double estimate_groups(const OptimizerBlk*, const SortNode*);
 static void find_index_relationship_streams(thread_db* tdbb, OptimizerBlk* opt,
 	const StreamList& streams, StreamList& dependent_streams, StreamList& free_streams);
 static void form_rivers(thread_db* tdbb, OptimizerBlk* opt, const StreamList& streams,
@@ -345,6 +347,8 @@ static RecordSource* gen_outer(thread_db* tdbb, OptimizerBlk* opt, RseNode* rse,
 static RecordSource* gen_residual_boolean(thread_db* tdbb, OptimizerBlk* opt, RecordSource* prior_rsb);
 static RecordSource* gen_retrieval(thread_db* tdbb, OptimizerBlk* opt, StreamType stream,
 	SortNode** sort_ptr, bool outer_flag, bool inner_flag, BoolExprNode** return_boolean);
+static void gen_block_ranges(thread_db*, CompilerScratch*, StreamType, jrd_rel*, BoolExprNode*,
+	Array<BlockRangeNode*>&);
 static bool gen_equi_join(thread_db*, OptimizerBlk*, RiverList&);
 static double get_cardinality(thread_db*, jrd_rel*, const Format*);
 static BoolExprNode* make_inference_node(CompilerScratch*, BoolExprNode*, ValueExprNode*, ValueExprNode*);
@@ -457,6 +461,10 @@ string OPT_get_plan(thread_db* tdbb, const jrd_req* request, bool detailed)
 
 	if (request)
 	{
+		// Record sources look for their profile counters in the current request
+		AutoSetRestore2<jrd_req*, thread_db> autoRequest(tdbb,
+			&thread_db::getRequest, &thread_db::setRequest, const_cast<jrd_req*>(request));
+
 		const Array<const RecordSource*>& fors = request->getStatement()->fors;
 
 		for (FB_SIZE_T i = 0; i < fors.getCount(); i++)
@@ -821,6 +829,19 @@ RecordSource* OPT_compile(thread_db* tdbb, CompilerScratch* csb, RseNode* rse,
 		sort = NULL;
 	}
 
+	// A GROUP BY may be evaluated by hashing rather than sorting,
+	// if the groups are known to be not too many
+
+	if (rse->flags & RseNode::FLAG_HASH_GROUPING)
+	{
+		const double groups = (sort && !project) ? estimate_groups(opt, sort) : 0;
+
+		if (groups > 0 && groups <= HashAggregatedStream::MAX_ESTIMATED_GROUPS)
+			sort = NULL;
+		else
+			rse->flags &= ~RseNode::FLAG_HASH_GROUPING;
+	}
+
 	// check index usage in all the base streams to ensure
 	// that any user-specified access plan is followed
 
@@ -1139,6 +1160,7 @@ static void check_sorts(CompilerScratch* csb, RseNode* rse)
 			{
 				set_direction(sort, group);
 				set_position(sort, group, static_cast<AggregateSourceNode*>(sub_rse)->map);
+				static_cast<AggregateSourceNode*>(sub_rse)->orderedGroups = true;
 				sort = rse->rse_sorted = NULL;
 			}
 		}
@@ -1682,6 +1704,69 @@ static USHORT distribute_equalities(BoolExprNodeStack& org_stack, CompilerScratc
 }
 
 
+static double estimate_groups(const OptimizerBlk* opt, const SortNode* group)
+{
+/**************************************
+ *
+ *	e s t i m a t e _ g r o u p s
+ *
+ **************************************
+ *
+ * Functional description
+ *	Estimate the number of groups produced by the given
+ *	GROUP BY clause. Only the plain fields of the base streams
+ *	are handled, their distinct values are derived from the
+ *	selectivity of the indices they lead. Zero means that
+ *	nothing is known.
+ *
+ **************************************/
+	const CompilerScratch* const csb = opt->opt_csb;
+
+	double groups = 1;
+	double cardinality = 1;
+
+	for (const NestConst<ValueExprNode>* ptr = group->expressions.begin();
+		 ptr != group->expressions.end(); ++ptr)
+	{
+		const FieldNode* const field = nodeAs<FieldNode>(*ptr);
+
+		if (!field || !opt->compileStreams.exist(field->fieldStream))
+			return 0;
+
+		const CompilerScratch::csb_repeat* const tail = &csb->csb_rpt[field->fieldStream];
+
+		if (!tail->csb_idx)
+			return 0;
+
+		double distinctValues = 0;
+		const index_desc* idx = tail->csb_idx->items;
+
+		for (USHORT i = 0; i < tail->csb_indices; i++, idx++)
+		{
+			if (idx->idx_count && !(idx->idx_flags & idx_expressn) &&
+				idx->idx_rpt[0].idx_field == field->fieldId &&
+				idx->idx_rpt[0].idx_selectivity > 0)
+			{
+				const double keys = 1 / idx->idx_rpt[0].idx_selectivity;
+
+				if (!distinctValues || keys < distinctValues)
+					distinctValues = keys;
+			}
+		}
+
+		if (!distinctValues)
+			return 0;
+
+		groups *= distinctValues;
+	}
+
+	for (const StreamType* i = opt->compileStreams.begin(); i != opt->compileStreams.end(); ++i)
+		cardinality *= MAX(csb->csb_rpt[*i].csb_cardinality, 1);
+
+	return MIN(groups, cardinality);
+}
+
+
 static void find_index_relationship_streams(thread_db* tdbb,
 											OptimizerBlk* opt,
 											const StreamList& streams,
@@ -2442,10 +2527,27 @@ static RecordSource* gen_retrieval(thread_db*     tdbb,
 		}
 		else
 		{
-			rsb = FB_NEW_POOL(*tdbb->getDefaultPool()) FullTableScan(csb, alias, stream, relation, dbkeyRanges);
+			FullTableScan* const scan_rsb =
+				FB_NEW_POOL(*tdbb->getDefaultPool()) FullTableScan(csb, alias, stream, relation, dbkeyRanges);
 
 			if (boolean)
+			{
 				csb->csb_rpt[stream].csb_flags |= csb_unmatched;
+
+				// Let the scan skip the pointer pages which summaries prove
+				// that no record there matches the local booleans
+
+				if (tdbb->getDatabase()->dbb_block_ranges && !relation->isTemporary())
+				{
+					Array<BlockRangeNode*> blockRanges;
+					gen_block_ranges(tdbb, csb, stream, relation, boolean, blockRanges);
+
+					if (blockRanges.hasData())
+						scan_rsb->setBlockRanges(csb, blockRanges);
+				}
+			}
+
+			rsb = scan_rsb;
 		}
 	}
 
@@ -2808,6 +2910,109 @@ SortedStream* OPT_gen_sort(thread_db* tdbb, CompilerScratch* csb, const StreamLi
 }
 
 
+static void gen_block_ranges(thread_db* tdbb, CompilerScratch* csb, StreamType stream,
+	jrd_rel* relation, BoolExprNode* boolean, Array<BlockRangeNode*>& ranges)
+{
+/**************************************
+ *
+ *	g e n _ b l o c k _ r a n g e s
+ *
+ **************************************
+ *
+ * Functional description
+ *	Collect the value ranges that conjunctions of the boolean
+ *	set for the fields of the stream. Only the fields of types
+ *	supported by the block range summaries are considered,
+ *	as well as the bounds that are cheap to re-evaluate and free
+ *	of side effects: literals, parameters and variables.
+ *
+ **************************************/
+	BinaryBoolNode* const binaryNode = nodeAs<BinaryBoolNode>(boolean);
+
+	if (binaryNode && binaryNode->blrOp == blr_and)
+	{
+		gen_block_ranges(tdbb, csb, stream, relation, binaryNode->arg1, ranges);
+		gen_block_ranges(tdbb, csb, stream, relation, binaryNode->arg2, ranges);
+		return;
+	}
+
+	ComparativeBoolNode* const cmpNode = nodeAs<ComparativeBoolNode>(boolean);
+
+	if (!cmpNode)
+		return;
+
+	const auto isBound = [](const ValueExprNode* node)
+	{
+		return node && (nodeIs<LiteralNode>(node) || nodeIs<ParameterNode>(node) ||
+			nodeIs<VariableNode>(node));
+	};
+
+	const FieldNode* fieldNode = nodeAs<FieldNode>(cmpNode->arg1);
+	bool swapped = false;
+
+	if (!fieldNode || fieldNode->fieldStream != stream)
+	{
+		if (cmpNode->blrOp == blr_between)
+			return;
+
+		fieldNode = nodeAs<FieldNode>(cmpNode->arg2);
+		swapped = true;
+
+		if (!fieldNode || fieldNode->fieldStream != stream || !isBound(cmpNode->arg1))
+			return;
+	}
+	else if (!isBound(cmpNode->arg2))
+		return;
+
+	const Format* const format = MET_current(tdbb, relation);
+
+	if (fieldNode->fieldId >= format->fmt_count ||
+		!BlockRanges::isSupported(&format->fmt_desc[fieldNode->fieldId]))
+	{
+		return;
+	}
+
+	ValueExprNode* const value = swapped ? cmpNode->arg1 : cmpNode->arg2;
+	ValueExprNode* lower = NULL;
+	ValueExprNode* upper = NULL;
+
+	switch (cmpNode->blrOp)
+	{
+	case blr_eql:
+		lower = upper = value;
+		break;
+
+	case blr_gtr:
+	case blr_geq:
+		if (swapped)
+			upper = value;	// value > field
+		else
+			lower = value;	// field > value
+		break;
+
+	case blr_lss:
+	case blr_leq:
+		if (swapped)
+			lower = value;	// value < field
+		else
+			upper = value;	// field < value
+		break;
+
+	case blr_between:
+		if (!isBound(cmpNode->arg3))
+			return;
+		lower = cmpNode->arg2;
+		upper = cmpNode->arg3;
+		break;
+
+	default:
+		return;
+	}
+
+	ranges.add(FB_NEW_POOL(csb->csb_pool) BlockRangeNode(fieldNode->fieldId, lower, upper));
+}
+
+
 static bool gen_equi_join(thread_db* tdbb, OptimizerBlk* opt, RiverList& org_rivers)
 {
 /**************************************
@@ -796,6 +796,54 @@ bool PIO_read(thread_db* tdbb, jrd_file* file, BufferDesc* bdb, Ods::pag* page,
 }
 
 
+void PIO_prefetch(thread_db* tdbb, jrd_file* file, ULONG page, ULONG count)
+{
+/**************************************
+ *
+ *	P I O _ p r e f e t c h
+ *
+ **************************************
+ *
+ * Functional description
+ *	Let the OS start reading a range of pages into
+ *	the file system cache. Errors are ignored as the
+ *	pages are going to be read in the usual way anyway.
+ *
+ **************************************/
+#ifdef POSIX_FADV_WILLNEED
+	Database* const dbb = tdbb->getDatabase();
+	const ULONG size = dbb->dbb_page_size;
+
+	EngineCheckout cout(tdbb, FB_FUNCTION, true);
+
+	while (count)
+	{
+		while (file && page > file->fil_max_page)
+			file = file->fil_next;
+
+		// Nothing to hint if the file system cache is not used
+
+		if (!file || page < file->fil_min_page || file->fil_desc == -1 ||
+			(file->fil_flags & FIL_no_fs_cache))
+		{
+			break;
+		}
+
+		const ULONG rest = file->fil_max_page - page;
+		const ULONG pages = (rest < count) ? rest + 1 : count;
+
+		const FB_UINT64 offset = (FB_UINT64) (page - file->fil_min_page + file->fil_fudge) * size;
+
+		os_utils::posix_fadvise(file->fil_desc, LSEEK_OFFSET_CAST offset,
+			(off_t) pages * size, POSIX_FADV_WILLNEED);
+
+		page += pages;
+		count -= pages;
+	}
+#endif
+}
+
+
 bool PIO_write(thread_db* tdbb, jrd_file* file, BufferDesc* bdb, Ods::pag* page, FbStatusVector* status_vector)
 {
 /**************************************
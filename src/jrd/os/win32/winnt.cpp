@@ -591,6 +591,23 @@ bool PIO_read(thread_db* tdbb, jrd_file* file, BufferDesc* bdb, Ods::pag* page,
 }
 
 
+void PIO_prefetch(thread_db*, jrd_file*, ULONG, ULONG)
+{
+/**************************************
+ *
+ *	P I O _ p r e f e t c h
+ *
+ **************************************
+ *
+ * Functional description
+ *	Let the OS start reading a range of pages.
+ *	Not supported, the system cache does read-ahead
+ *	of the sequentially accessed files by itself.
+ *
+ **************************************/
+}
+
+
 #ifdef SUPERSERVER_V2
 bool PIO_read_ahead(thread_db*	tdbb,
 				   SLONG	start_page,
@@ -52,7 +52,7 @@ BaseAggWinStream<ThisType, NextType>::BaseAggWinStream(thread_db* tdbb, Compiler
 }
 
 template <typename ThisType, typename NextType>
-void BaseAggWinStream<ThisType, NextType>::open(thread_db* tdbb) const
+void BaseAggWinStream<ThisType, NextType>::internalOpen(thread_db* tdbb) const
 {
 	jrd_req* const request = tdbb->getRequest();
 	Impure* const impure = getImpure(request);
@@ -355,8 +355,9 @@ bool BaseAggWinStream<ThisType, NextType>::getNextRecord(thread_db* tdbb, jrd_re
 		return m_next->getRecord(tdbb);
 }
 
-// Export the template for WindowedStream::WindowStream.
+// Export the template for WindowedStream::WindowStream and HashAggregatedStream.
 template class Jrd::BaseAggWinStream<WindowedStream::WindowStream, BaseBufferedStream>;
+template class Jrd::BaseAggWinStream<HashAggregatedStream, RecordSource>;
 
 // ------------------------------
 
@@ -370,12 +371,12 @@ AggregatedStream::AggregatedStream(thread_db* tdbb, CompilerScratch* csb, Stream
 void AggregatedStream::print(thread_db* tdbb, string& plan, bool detailed, unsigned level) const
 {
 	if (detailed)
-		plan += printIndent(++level) + "Aggregate";
+		plan += printIndent(++level) + "Aggregate" + printProfile(tdbb);
 
 	m_next->print(tdbb, plan, detailed, level);
 }
 
-bool AggregatedStream::getRecord(thread_db* tdbb) const
+bool AggregatedStream::internalGetRecord(thread_db* tdbb) const
 {
 	JRD_reschedule(tdbb);
 
@@ -112,7 +112,7 @@ BufferedStream::BufferedStream(CompilerScratch* csb, RecordSource* next)
 	m_format = format;
 }
 
-void BufferedStream::open(thread_db* tdbb) const
+void BufferedStream::internalOpen(thread_db* tdbb) const
 {
 	jrd_req* const request = tdbb->getRequest();
 	Impure* const impure = request->getImpure<Impure>(m_impure);
@@ -147,7 +147,7 @@ void BufferedStream::close(thread_db* tdbb) const
 	}
 }
 
-bool BufferedStream::getRecord(thread_db* tdbb) const
+bool BufferedStream::internalGetRecord(thread_db* tdbb) const
 {
 	JRD_reschedule(tdbb);
 
@@ -315,7 +315,7 @@ void BufferedStream::print(thread_db* tdbb, string& plan, bool detailed, unsigne
 		string extras;
 		extras.printf(" (record length: %" ULONGFORMAT")", m_format->fmt_length);
 
-		plan += printIndent(++level) + "Record Buffer" + extras;
+		plan += printIndent(++level) + "Record Buffer" + extras + printProfile(tdbb);
 	}
 
 	m_next->print(tdbb, plan, detailed, level);
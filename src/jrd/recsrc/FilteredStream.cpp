@@ -37,14 +37,14 @@ using namespace Jrd;
 
 FilteredStream::FilteredStream(CompilerScratch* csb, RecordSource* next, BoolExprNode* boolean)
 	: m_next(next), m_boolean(boolean), m_anyBoolean(NULL),
-	  m_ansiAny(false), m_ansiAll(false), m_ansiNot(false)
+	  m_ansiAny(false), m_ansiAll(false), m_ansiNot(false), m_joinFilter(NULL)
 {
 	fb_assert(m_next && m_boolean);
 
 	m_impure = csb->allocImpure<Impure>();
 }
 
-void FilteredStream::open(thread_db* tdbb) const
+void FilteredStream::internalOpen(thread_db* tdbb) const
 {
 	jrd_req* const request = tdbb->getRequest();
 	Impure* const impure = request->getImpure<Impure>(m_impure);
@@ -70,7 +70,7 @@ void FilteredStream::close(thread_db* tdbb) const
 	}
 }
 
-bool FilteredStream::getRecord(thread_db* tdbb) const
+bool FilteredStream::internalGetRecord(thread_db* tdbb) const
 {
 	JRD_reschedule(tdbb);
 
@@ -102,10 +102,30 @@ bool FilteredStream::lockRecord(thread_db* tdbb) const
 	return m_next->lockRecord(tdbb);
 }
 
+bool FilteredStream::pushJoinFilter(const HashJoin* join, StreamType stream)
+{
+	// Rejected records are the same as not matching the boolean,
+	// but it's not so for the quantified predicates
+	if (m_anyBoolean || m_joinFilter)
+		return false;
+
+	// Check the filter after the boolean, so the join keys are never
+	// evaluated for the records the boolean rejects
+
+	StreamList streams;
+	m_next->findUsedStreams(streams);
+
+	if (streams.getCount() != 1 || streams[0] != stream)
+		return false;
+
+	m_joinFilter = join;
+	return true;
+}
+
 void FilteredStream::print(thread_db* tdbb, string& plan, bool detailed, unsigned level) const
 {
 	if (detailed)
-		plan += printIndent(++level) + "Filter";
+		plan += printIndent(++level) + "Filter" + printProfile(tdbb);
 
 	m_next->print(tdbb, plan, detailed, level);
 }
@@ -344,6 +364,9 @@ bool FilteredStream::evaluateBoolean(thread_db* tdbb) const
 	{
 		if (m_boolean->execute(tdbb, request))
 		{
+			if (m_joinFilter && !m_joinFilter->checkFilter(tdbb))
+				continue;
+
 			result = true;
 			break;
 		}
@@ -44,7 +44,7 @@ FirstRowsStream::FirstRowsStream(CompilerScratch* csb, RecordSource* next, Value
 	m_impure = csb->allocImpure<Impure>();
 }
 
-void FirstRowsStream::open(thread_db* tdbb) const
+void FirstRowsStream::internalOpen(thread_db* tdbb) const
 {
 	jrd_req* const request = tdbb->getRequest();
 	Impure* const impure = request->getImpure<Impure>(m_impure);
@@ -61,6 +61,7 @@ void FirstRowsStream::open(thread_db* tdbb) const
 	{
 		impure->irsb_flags = irsb_open;
 		impure->irsb_count = value;
+		m_next->setRowLimit(request, value);
 		m_next->open(tdbb);
 	}
 }
@@ -81,7 +82,7 @@ void FirstRowsStream::close(thread_db* tdbb) const
 	}
 }
 
-bool FirstRowsStream::getRecord(thread_db* tdbb) const
+bool FirstRowsStream::internalGetRecord(thread_db* tdbb) const
 {
 	JRD_reschedule(tdbb);
 
@@ -115,7 +116,7 @@ bool FirstRowsStream::lockRecord(thread_db* tdbb) const
 void FirstRowsStream::print(thread_db* tdbb, string& plan, bool detailed, unsigned level) const
 {
 	if (detailed)
-		plan += printIndent(++level) + "First N Records";
+		plan += printIndent(++level) + "First N Records" + printProfile(tdbb);
 
 	m_next->print(tdbb, plan, detailed, level);
 }
@@ -23,9 +23,11 @@
 #include "../jrd/cmp_proto.h"
 #include "../jrd/dpm_proto.h"
 #include "../jrd/evl_proto.h"
+#include "../jrd/mov_proto.h"
 #include "../jrd/vio_proto.h"
 #include "../jrd/rlck_proto.h"
 #include "../jrd/Attachment.h"
+#include "../jrd/BlockRanges.h"
 
 #include "RecordSource.h"
 
@@ -42,12 +44,24 @@ FullTableScan::FullTableScan(CompilerScratch* csb, const string& alias,
 	: RecordStream(csb, stream),
 	  m_alias(csb->csb_pool, alias),
 	  m_relation(relation),
-	  m_dbkeyRanges(csb->csb_pool, dbkeyRanges)
+	  m_dbkeyRanges(csb->csb_pool, dbkeyRanges),
+	  m_blockRanges(csb->csb_pool),
+	  m_rangeImpure(0),
+	  m_joinFilter(NULL)
 {
 	m_impure = csb->allocImpure<Impure>();
 }
 
-void FullTableScan::open(thread_db* tdbb) const
+void FullTableScan::setBlockRanges(CompilerScratch* csb, const Array<BlockRangeNode*>& blockRanges)
+{
+	fb_assert(m_blockRanges.isEmpty());
+
+	m_blockRanges.assign(blockRanges);
+	m_rangeImpure = csb->allocImpure(alignof(BlockRanges::Summary),
+		sizeof(BlockRanges::Summary) * m_blockRanges.getCount());
+}
+
+void FullTableScan::internalOpen(thread_db* tdbb) const
 {
 	Database* const dbb = tdbb->getDatabase();
 	Attachment* const attachment = tdbb->getAttachment();
@@ -55,6 +69,11 @@ void FullTableScan::open(thread_db* tdbb) const
 	Impure* const impure = request->getImpure<Impure>(m_impure);
 
 	impure->irsb_flags = irsb_open;
+	impure->irsb_range_entered = false;
+	impure->irsb_range_collect = false;
+
+	if (m_blockRanges.hasData() && dbb->dbb_block_ranges)
+		impure->irsb_range_generation = dbb->dbb_block_ranges->getGeneration();
 
 	RLCK_reserve_relation(tdbb, request->req_transaction, m_relation, false);
 
@@ -131,7 +150,7 @@ void FullTableScan::close(thread_db* tdbb) const
 	}
 }
 
-bool FullTableScan::getRecord(thread_db* tdbb) const
+bool FullTableScan::internalGetRecord(thread_db* tdbb) const
 {
 	JRD_reschedule(tdbb);
 
@@ -145,22 +164,235 @@ bool FullTableScan::getRecord(thread_db* tdbb) const
 		return false;
 	}
 
-	if (VIO_next_record(tdbb, rpb, request->req_transaction, request->req_pool, false))
+	Database* const dbb = tdbb->getDatabase();
+
+	while (VIO_next_record(tdbb, rpb, request->req_transaction, request->req_pool, false))
 	{
 		if (impure->irsb_upper.isValid() && rpb->rpb_number > impure->irsb_upper)
 		{
+			impure->irsb_range_collect = false;
 			rpb->rpb_number.setValid(false);
 			return false;
 		}
 
+		if (m_blockRanges.hasData() && dbb->dbb_block_ranges)
+		{
+			USHORT line, slot;
+			ULONG ppSequence;
+			rpb->rpb_number.decompose(dbb->dbb_max_records, dbb->dbb_dp_per_pp,
+				line, slot, ppSequence);
+
+			if (!impure->irsb_range_entered || impure->irsb_range_pp != ppSequence)
+			{
+				finishRange(tdbb, impure);
+
+				if (!enterRange(tdbb, impure, ppSequence))
+				{
+					// No record of this pointer page matches the ranges,
+					// position at its last record to continue with the next one
+					rpb->rpb_number.compose(dbb->dbb_max_records, dbb->dbb_dp_per_pp,
+						dbb->dbb_max_records - 1, dbb->dbb_dp_per_pp - 1, ppSequence);
+					continue;
+				}
+			}
+
+			if (impure->irsb_range_collect)
+				collectRange(tdbb, impure);
+		}
+
 		rpb->rpb_number.setValid(true);
+
+		if (m_joinFilter && !m_joinFilter->checkFilter(tdbb))
+			continue;
+
 		return true;
 	}
 
+	// The last pointer page is read completely, its summaries are ready
+	finishRange(tdbb, impure);
+
 	rpb->rpb_number.setValid(false);
 	return false;
 }
 
+bool FullTableScan::enterRange(thread_db* tdbb, Impure* impure, ULONG ppSequence) const
+{
+	Database* const dbb = tdbb->getDatabase();
+	BlockRanges* const cache = dbb->dbb_block_ranges;
+	jrd_req* const request = tdbb->getRequest();
+	BlockRanges::Summary* const summaries = request->getImpure<BlockRanges::Summary>(m_rangeImpure);
+
+	// Summaries collected for this pointer page are valid only if nothing
+	// was changed here since the moment before its first record was read
+
+	const FB_UINT64 generation = impure->irsb_range_generation;
+	impure->irsb_range_generation = cache->getGeneration();
+
+	impure->irsb_range_pp = ppSequence;
+	impure->irsb_range_entered = true;
+	impure->irsb_range_collect = false;
+
+	if (!DPM_all_swept(tdbb, m_relation, ppSequence))
+		return true;
+
+	bool complete = true;
+
+	for (FB_SIZE_T i = 0; i < m_blockRanges.getCount(); i++)
+	{
+		const BlockRangeNode* const range = m_blockRanges[i];
+		BlockRanges::Summary& summary = summaries[i];
+
+		if (!cache->get(m_relation->rel_id, range->fieldId, ppSequence, summary))
+		{
+			complete = false;
+			continue;
+		}
+
+		// Nothing but NULLs, the comparison cannot be true
+		if (!summary.hasValues)
+			return false;
+
+		if (range->lower)
+		{
+			const dsc* const desc = EVL_expr(tdbb, request, range->lower);
+
+			if (desc && !(request->req_flags & req_null))
+			{
+				dsc maxDesc;
+				summary.getMax(&maxDesc);
+
+				if (MOV_compare(tdbb, &maxDesc, desc) < 0)
+					return false;
+			}
+		}
+
+		if (range->upper)
+		{
+			const dsc* const desc = EVL_expr(tdbb, request, range->upper);
+
+			if (desc && !(request->req_flags & req_null))
+			{
+				dsc minDesc;
+				summary.getMin(&minDesc);
+
+				if (MOV_compare(tdbb, &minDesc, desc) > 0)
+					return false;
+			}
+		}
+	}
+
+	if (complete)
+		return true;
+
+	// Collect the summaries unless the scan was started in the middle of the pointer page
+
+	if (impure->irsb_lower.isValid())
+	{
+		USHORT line, slot;
+		ULONG lowerSequence;
+		impure->irsb_lower.decompose(dbb->dbb_max_records, dbb->dbb_dp_per_pp,
+			line, slot, lowerSequence);
+
+		if (lowerSequence == ppSequence && (line || slot))
+			return true;
+	}
+
+	for (FB_SIZE_T i = 0; i < m_blockRanges.getCount(); i++)
+	{
+		BlockRanges::Summary& summary = summaries[i];
+		summary.generation = generation;
+		summary.hasValues = false;
+		summary.desc.clear();
+	}
+
+	impure->irsb_range_collect = true;
+	return true;
+}
+
+void FullTableScan::collectRange(thread_db* tdbb, Impure* impure) const
+{
+	jrd_req* const request = tdbb->getRequest();
+	record_param* const rpb = &request->req_rpb[m_stream];
+	BlockRanges::Summary* const summaries = request->getImpure<BlockRanges::Summary>(m_rangeImpure);
+
+	for (FB_SIZE_T i = 0; i < m_blockRanges.getCount(); i++)
+	{
+		BlockRanges::Summary& summary = summaries[i];
+
+		dsc desc;
+		if (!EVL_field(m_relation, rpb->rpb_record, m_blockRanges[i]->fieldId, &desc))
+			continue;
+
+		if (!summary.hasValues)
+		{
+			if (!BlockRanges::isSupported(&desc))
+			{
+				impure->irsb_range_collect = false;
+				return;
+			}
+
+			summary.desc = desc;
+			summary.desc.dsc_address = NULL;
+			memcpy(summary.minValue, desc.dsc_address, desc.dsc_length);
+			memcpy(summary.maxValue, desc.dsc_address, desc.dsc_length);
+			summary.hasValues = true;
+			continue;
+		}
+
+		// Records of different formats may keep the field in different data types
+
+		if (desc.dsc_dtype != summary.desc.dsc_dtype ||
+			desc.dsc_length != summary.desc.dsc_length ||
+			desc.dsc_scale != summary.desc.dsc_scale)
+		{
+			impure->irsb_range_collect = false;
+			return;
+		}
+
+		dsc boundDesc;
+
+		summary.getMin(&boundDesc);
+		if (MOV_compare(tdbb, &desc, &boundDesc) < 0)
+			memcpy(summary.minValue, desc.dsc_address, desc.dsc_length);
+
+		summary.getMax(&boundDesc);
+		if (MOV_compare(tdbb, &desc, &boundDesc) > 0)
+			memcpy(summary.maxValue, desc.dsc_address, desc.dsc_length);
+	}
+}
+
+void FullTableScan::finishRange(thread_db* tdbb, Impure* impure) const
+{
+	if (!impure->irsb_range_collect)
+		return;
+
+	impure->irsb_range_collect = false;
+
+	// Pages could be changed while they were read, the cache would
+	// reject such summaries but only if swept pages are still there
+
+	const ULONG ppSequence = impure->irsb_range_pp;
+
+	if (!DPM_all_swept(tdbb, m_relation, ppSequence))
+		return;
+
+	BlockRanges* const cache = tdbb->getDatabase()->dbb_block_ranges;
+	const BlockRanges::Summary* const summaries =
+		tdbb->getRequest()->getImpure<BlockRanges::Summary>(m_rangeImpure);
+
+	for (FB_SIZE_T i = 0; i < m_blockRanges.getCount(); i++)
+		cache->put(m_relation->rel_id, m_blockRanges[i]->fieldId, ppSequence, summaries[i]);
+}
+
+bool FullTableScan::pushJoinFilter(const HashJoin* join, StreamType stream)
+{
+	if (stream != m_stream || m_joinFilter)
+		return false;
+
+	m_joinFilter = join;
+	return true;
+}
+
 void FullTableScan::print(thread_db* tdbb, string& plan, bool detailed, unsigned level) const
 {
 	if (detailed)
@@ -183,8 +415,12 @@ void FullTableScan::print(thread_db* tdbb, string& plan, bool detailed, unsigned
 		else if (upperBounds)
 			bounds += " (upper bound)";
 
+		if (m_blockRanges.hasData() && tdbb->getDatabase()->dbb_block_ranges)
+			bounds += " (block ranges)";
+
 		plan += printIndent(++level) + "Table " +
-			printName(tdbb, m_relation->rel_name.c_str(), m_alias) + " Full Scan" + bounds;
+			printName(tdbb, m_relation->rel_name.c_str(), m_alias) + " Full Scan" + bounds +
+			printProfile(tdbb);
 	}
 	else
 	{
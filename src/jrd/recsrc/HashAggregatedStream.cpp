@@ -0,0 +1,742 @@
+/*
+ *  The contents of this file are subject to the Initial
+ *  Developer's Public License Version 1.0 (the "License");
+ *  you may not use this file except in compliance with the
+ *  License. You may obtain a copy of the License at
+ *  http://www.ibphoenix.com/main.nfs?a=ibphoenix&page=ibp_idpl.
+ *
+ *  Software distributed under the License is distributed AS IS,
+ *  WITHOUT WARRANTY OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing rights
+ *  and limitations under the License.
+ *
+ *  The Original Code was created for the Firebird Open Source RDBMS project.
+ *
+ *  All Rights Reserved.
+ *  Contributor(s): ______________________________________.
+ */
+
+#include "firebird.h"
+#include "../common/classes/Aligner.h"
+#include "../common/classes/Hash.h"
+#include "../jrd/jrd.h"
+#include "../jrd/req.h"
+#include "../jrd/intl.h"
+#include "../jrd/align.h"
+#include "../jrd/TempSpace.h"
+#include "../dsql/Nodes.h"
+#include "../jrd/evl_proto.h"
+#include "../jrd/exe_proto.h"
+#include "../jrd/intl_proto.h"
+#include "../jrd/mov_proto.h"
+#include "../jrd/vio_proto.h"
+
+#include "RecordSource.h"
+
+using namespace Firebird;
+using namespace Jrd;
+
+// ----------------------------
+// Data access: hash aggregation
+// ----------------------------
+
+static const char* const SCRATCH = "fb_hashagg_";
+
+static const ULONG MIN_TABLE_BITS = 10;
+static const FB_SIZE_T MAX_TABLE_MEMORY = 16 * 1024 * 1024;		// 16MB per stream
+static const FB_SIZE_T CHUNK_SIZE = 64 * 1024;
+
+static const ULONG PARTITION_BITS = 4;
+static const ULONG PARTITION_COUNT = 1 << PARTITION_BITS;
+static const ULONG MAX_PARTITION_LEVELS = 32 / PARTITION_BITS;	// until the hash bits are exhausted
+
+// Groups are kept in the open addressing (linear probing) table of indices
+// into the array of group pointers. Every group holds the aggregate states,
+// the aggregate record and the group key. When the memory limit is reached,
+// the new groups are not added anymore, instead their records are spilled
+// into the partitions chosen by the next PARTITION_BITS of the hash value.
+// These partitions are aggregated one by one after the current groups are
+// returned, and so on recursively.
+
+class HashAggregatedStream::GroupTable : public PermanentStorage
+{
+	struct Partition
+	{
+		TempSpace* space;
+		offset_t count;
+		ULONG level;
+	};
+
+public:
+	GroupTable(MemoryPool& pool, ULONG keyLength, ULONG dataLength, ULONG spillLength)
+		: PermanentStorage(pool),
+		  m_keyLength(keyLength), m_groupLength(dataLength + keyLength),
+		  m_spillLength(spillLength),
+		  m_chunkLength(MAX(CHUNK_SIZE, m_groupLength)),
+		  m_groups(pool), m_hashes(pool), m_slots(pool), m_chunks(pool),
+		  m_chunkSpace(0), m_memory(0), m_level(0),
+		  m_key(pool), m_spillBuffer(pool), m_pending(pool),
+		  m_position(0)
+	{
+		m_key.getBuffer(keyLength);
+		m_spillBuffer.getBuffer(spillLength);
+
+		memset(m_spilled, 0, sizeof(m_spilled));
+		m_current.space = NULL;
+		m_current.count = 0;
+
+		resize(MIN_TABLE_BITS);
+	}
+
+	~GroupTable()
+	{
+		clear();
+
+		for (ULONG i = 0; i < PARTITION_COUNT; i++)
+			delete m_spilled[i].space;
+
+		for (FB_SIZE_T i = 0; i < m_pending.getCount(); i++)
+			delete m_pending[i].space;
+
+		delete m_current.space;
+	}
+
+	UCHAR* getKeyBuffer()
+	{
+		return m_key.begin();
+	}
+
+	UCHAR* getSpillBuffer()
+	{
+		return m_spillBuffer.begin();
+	}
+
+	ULONG getCount() const
+	{
+		return m_groups.getCount();
+	}
+
+	UCHAR* getGroup(ULONG index) const
+	{
+		return m_groups[index];
+	}
+
+	bool isFull() const
+	{
+		return m_level < MAX_PARTITION_LEVELS && m_memory >= MAX_TABLE_MEMORY;
+	}
+
+	UCHAR* find(ULONG hash, const UCHAR* key) const
+	{
+		for (ULONG slot = getSlot(hash); m_slots[slot]; slot = (slot + 1) & m_mask)
+		{
+			const ULONG index = m_slots[slot] - 1;
+			UCHAR* const group = m_groups[index];
+
+			if (m_hashes[index] == hash &&
+				!memcmp(group + m_groupLength - m_keyLength, key, m_keyLength))
+			{
+				return group;
+			}
+		}
+
+		return NULL;
+	}
+
+	UCHAR* add(ULONG hash, const UCHAR* key)
+	{
+		// Keep the load factor below 1/2
+
+		if ((m_groups.getCount() + 1) * 2 > m_slots.getCount())
+			resize(m_bits + 1);
+
+		if (m_chunkSpace < m_groupLength)
+		{
+			m_chunks.add(FB_NEW_POOL(getPool()) UCHAR[m_chunkLength]);
+			m_chunkSpace = m_chunkLength;
+			m_memory += m_chunkLength;
+		}
+
+		UCHAR* const group = m_chunks.back() + (m_chunkLength - m_chunkSpace);
+		m_chunkSpace -= m_groupLength;
+
+		memcpy(group + m_groupLength - m_keyLength, key, m_keyLength);
+
+		m_groups.add(group);
+		m_hashes.add(hash);
+
+		ULONG slot = getSlot(hash);
+		while (m_slots[slot])
+			slot = (slot + 1) & m_mask;
+
+		m_slots[slot] = m_groups.getCount();
+
+		return group;
+	}
+
+	void spill(ULONG hash, const UCHAR* data)
+	{
+		fb_assert(m_level < MAX_PARTITION_LEVELS);
+
+		const ULONG shift = 32 - PARTITION_BITS * (m_level + 1);
+		Partition& partition = m_spilled[(hash >> shift) & (PARTITION_COUNT - 1)];
+
+		if (!partition.space)
+		{
+			partition.space = FB_NEW_POOL(getPool()) TempSpace(getPool(), SCRATCH);
+			partition.count = 0;
+			partition.level = m_level + 1;
+		}
+
+		partition.space->write(partition.count++ * m_spillLength, data, m_spillLength);
+	}
+
+	// Forget the current groups and switch to the next spilled partition
+	bool nextPartition()
+	{
+		clear();
+
+		delete m_current.space;
+		m_current.space = NULL;
+
+		for (ULONG i = 0; i < PARTITION_COUNT; i++)
+		{
+			if (m_spilled[i].space)
+			{
+				m_pending.push(m_spilled[i]);
+				m_spilled[i].space = NULL;
+			}
+		}
+
+		if (m_pending.isEmpty())
+			return false;
+
+		m_current = m_pending.pop();
+		m_level = m_current.level;
+		m_position = 0;
+
+		return true;
+	}
+
+	const UCHAR* readSpilled()
+	{
+		if (m_position >= m_current.count)
+			return NULL;
+
+		UCHAR* const data = m_spillBuffer.begin();
+		m_current.space->read(m_position++ * m_spillLength, data, m_spillLength);
+
+		return data;
+	}
+
+private:
+	ULONG getSlot(ULONG hash) const
+	{
+		// Fibonacci hashing takes the high bits of the product, so all the hash bits
+		// are mixed in, including the ones that are constant inside a partition
+		return (ULONG) (hash * 2654435769U) >> (32 - m_bits);
+	}
+
+	void resize(ULONG bits)
+	{
+		m_bits = bits;
+		m_mask = (1 << bits) - 1;
+
+		m_memory -= m_slots.getCount() * sizeof(ULONG);
+		m_slots.clear();
+		m_slots.resize(1 << bits, 0);
+		m_memory += m_slots.getCount() * sizeof(ULONG);
+
+		for (FB_SIZE_T index = 0; index < m_groups.getCount(); index++)
+		{
+			ULONG slot = getSlot(m_hashes[index]);
+			while (m_slots[slot])
+				slot = (slot + 1) & m_mask;
+
+			m_slots[slot] = index + 1;
+		}
+	}
+
+	void clear()
+	{
+		for (FB_SIZE_T i = 0; i < m_chunks.getCount(); i++)
+			delete[] m_chunks[i];
+
+		m_chunks.clear();
+		m_chunkSpace = 0;
+
+		m_groups.clear();
+		m_hashes.clear();
+
+		m_memory = 0;
+		m_slots.clear();
+		resize(MIN_TABLE_BITS);
+	}
+
+	const ULONG m_keyLength;
+	const ULONG m_groupLength;
+	const ULONG m_spillLength;
+	const FB_SIZE_T m_chunkLength;
+
+	Array<UCHAR*> m_groups;
+	Array<ULONG> m_hashes;
+	Array<ULONG> m_slots;			// group index + 1, zero for the empty slot
+	ULONG m_bits;
+	ULONG m_mask;
+
+	Array<UCHAR*> m_chunks;
+	FB_SIZE_T m_chunkSpace;			// unused space in the last chunk
+	FB_SIZE_T m_memory;
+	ULONG m_level;					// partition level of the current groups
+
+	Array<UCHAR> m_key;
+	Array<UCHAR> m_spillBuffer;
+
+	Partition m_spilled[PARTITION_COUNT];
+	Array<Partition> m_pending;
+	Partition m_current;
+	offset_t m_position;
+};
+
+
+HashAggregatedStream::HashAggregatedStream(thread_db* tdbb, CompilerScratch* csb, StreamType stream,
+			NestValueArray* group, MapNode* map, RecordSource* next)
+	: BaseAggWinStream(tdbb, csb, stream, group, map, false, next),
+	  m_keyLengths(csb->csb_pool),
+	  m_stateOffsets(csb->csb_pool),
+	  m_arguments(csb->csb_pool),
+	  m_keyLength(0),
+	  m_stateLength(0),
+	  m_spillLength(0)
+{
+	fb_assert(group && map);
+
+	for (NestConst<ValueExprNode>* ptr = group->begin(); ptr != group->end(); ++ptr)
+	{
+		dsc desc;
+		(*ptr)->getDesc(tdbb, csb, &desc);
+
+		const USHORT keyLength = getKeyLength(tdbb, &desc);
+		m_keyLengths.add(keyLength);
+		m_keyLength += 1 + keyLength;	// NULL flag and value
+	}
+
+	// The spilled record consists of the hash value, the group key,
+	// the aggregate record and the values of the aggregate arguments
+
+	m_spillLength = sizeof(ULONG) + m_keyLength + m_format->fmt_length;
+
+	for (NestConst<ValueExprNode>* source = map->sourceList.begin();
+		 source != map->sourceList.end();
+		 ++source)
+	{
+		AggNode* const aggNode = nodeAs<AggNode>(*source);
+
+		if (!aggNode)
+			continue;
+
+		const bool copyable = aggNode->getStateOffsets(m_stateOffsets);
+		fb_assert(copyable);
+
+		SpilledArgument& argument = m_arguments.add();
+		argument.aggNode = aggNode;
+		argument.nullOffset = m_spillLength++;
+		argument.desc.clear();
+
+		if (aggNode->arg)
+		{
+			aggNode->arg->getDesc(tdbb, csb, &argument.desc);
+
+			m_spillLength = FB_ALIGN(m_spillLength, type_alignments[argument.desc.dsc_dtype]);
+			argument.desc.dsc_address = (UCHAR*)(IPTR) m_spillLength;
+			m_spillLength += argument.desc.dsc_length;
+		}
+	}
+
+	m_stateLength = m_stateOffsets.getCount() * sizeof(impure_value_ex);
+}
+
+bool HashAggregatedStream::isSupported(thread_db* tdbb, CompilerScratch* csb,
+	NestValueArray* group, MapNode* map)
+{
+	// The group keys must be comparable in their binary form, see computeKey()
+
+	ULONG keyLength = 0;
+
+	for (NestConst<ValueExprNode>* ptr = group->begin(); ptr != group->end(); ++ptr)
+	{
+		dsc desc;
+		(*ptr)->getDesc(tdbb, csb, &desc);
+
+		if (desc.isUnknown() || desc.isBlob() || desc.dsc_dtype == dtype_array)
+			return false;
+
+		keyLength += 1 + getKeyLength(tdbb, &desc);
+	}
+
+	if (keyLength > MAX_KEY_LENGTH)
+		return false;
+
+	// The aggregate states must be copyable, so the values kept
+	// outside of the impure area are not allowed
+
+	Array<ULONG> offsets(*tdbb->getDefaultPool());
+
+	for (NestConst<ValueExprNode>* source = map->sourceList.begin();
+		 source != map->sourceList.end();
+		 ++source)
+	{
+		AggNode* const aggNode = nodeAs<AggNode>(*source);
+
+		if (!aggNode)
+			continue;
+
+		if (!aggNode->getStateOffsets(offsets))
+			return false;
+
+		dsc desc;
+		aggNode->getDesc(tdbb, csb, &desc);
+
+		if (desc.isText() || desc.isDbKey() || desc.isBlob())
+			return false;
+
+		if (aggNode->arg)
+		{
+			aggNode->arg->getDesc(tdbb, csb, &desc);
+
+			if (desc.isUnknown() || desc.isBlob() || desc.dsc_dtype == dtype_array)
+				return false;
+		}
+	}
+
+	return true;
+}
+
+void HashAggregatedStream::internalOpen(thread_db* tdbb) const
+{
+	jrd_req* const request = tdbb->getRequest();
+	Impure* const impure = getImpure(request);
+
+	impure->irsb_flags = irsb_open;
+	impure->state = STATE_GROUPING;
+
+	VIO_record(tdbb, &request->req_rpb[m_stream], m_format, tdbb->getDefaultPool());
+
+	delete impure->irsb_groups;
+	impure->irsb_groups = FB_NEW_POOL(*tdbb->getDefaultPool())
+		GroupTable(*tdbb->getDefaultPool(), m_keyLength, m_stateLength + m_format->fmt_length,
+				   m_spillLength);
+	impure->irsb_position = 0;
+
+	m_next->open(tdbb);
+
+	while (m_next->getRecord(tdbb))
+		aggregate(tdbb, request, impure->irsb_groups);
+}
+
+void HashAggregatedStream::close(thread_db* tdbb) const
+{
+	jrd_req* const request = tdbb->getRequest();
+	Impure* const impure = getImpure(request);
+
+	if (impure->irsb_flags & irsb_open)
+	{
+		delete impure->irsb_groups;
+		impure->irsb_groups = NULL;
+	}
+
+	BaseAggWinStream::close(tdbb);
+}
+
+void HashAggregatedStream::print(thread_db* tdbb, string& plan, bool detailed, unsigned level) const
+{
+	if (detailed)
+		plan += printIndent(++level) + "Hash Aggregate" + printProfile(tdbb);
+
+	m_next->print(tdbb, plan, detailed, level);
+}
+
+bool HashAggregatedStream::internalGetRecord(thread_db* tdbb) const
+{
+	JRD_reschedule(tdbb);
+
+	jrd_req* const request = tdbb->getRequest();
+	record_param* const rpb = &request->req_rpb[m_stream];
+	Impure* const impure = getImpure(request);
+
+	if (!(impure->irsb_flags & irsb_open))
+	{
+		rpb->rpb_number.setValid(false);
+		return false;
+	}
+
+	GroupTable* const groups = impure->irsb_groups;
+
+	while (impure->irsb_position >= groups->getCount())
+	{
+		if (!groups->nextPartition())
+		{
+			rpb->rpb_number.setValid(false);
+			return false;
+		}
+
+		while (const UCHAR* const data = groups->readSpilled())
+			aggregateSpilled(tdbb, request, groups, data);
+
+		impure->irsb_position = 0;
+	}
+
+	const UCHAR* const group = groups->getGroup(impure->irsb_position++);
+
+	memcpy(rpb->rpb_record->getData(), group + m_stateLength, m_format->fmt_length);
+	restoreState(request, group);
+	aggExecute(tdbb, request, m_groupMap->sourceList, m_groupMap->targetList);
+
+	rpb->rpb_number.setValid(true);
+	return true;
+}
+
+USHORT HashAggregatedStream::getKeyLength(thread_db* tdbb, const dsc* desc)
+{
+	USHORT keyLength = desc->isText() ? desc->getStringLength() : desc->dsc_length;
+
+	if (IS_INTL_DATA(desc))
+		keyLength = INTL_key_length(tdbb, INTL_INDEX_TYPE(desc), keyLength);
+	else if (desc->isTime())
+		keyLength = sizeof(ISC_TIME);
+	else if (desc->isTimeStamp())
+		keyLength = sizeof(ISC_TIMESTAMP);
+	else if (desc->dsc_dtype == dtype_dec64)
+		keyLength = Decimal64::getKeyLength();
+	else if (desc->dsc_dtype == dtype_dec128)
+		keyLength = Decimal128::getKeyLength();
+
+	return keyLength;
+}
+
+// Make the binary comparable group key, as HashJoin does for the join keys,
+// but prefixing every value with the NULL flag as NULLs form a group too.
+ULONG HashAggregatedStream::computeKey(thread_db* tdbb, jrd_req* request, UCHAR* keyBuffer) const
+{
+	memset(keyBuffer, 0, m_keyLength);
+
+	UCHAR* keyPtr = keyBuffer;
+
+	for (FB_SIZE_T i = 0; i < m_group->getCount(); i++)
+	{
+		dsc* const desc = EVL_expr(tdbb, request, (*m_group)[i]);
+		const USHORT keyLength = m_keyLengths[i];
+
+		if (!desc || (request->req_flags & req_null))
+			*keyPtr = 1;
+		else
+		{
+			UCHAR* const valuePtr = keyPtr + 1;
+
+			if (desc->isText())
+			{
+				dsc to;
+				to.makeText(keyLength, desc->getTextType(), valuePtr);
+
+				if (IS_INTL_DATA(desc))
+				{
+					// Convert the INTL string into the binary comparable form
+					INTL_string_to_key(tdbb, INTL_INDEX_TYPE(desc),
+									   desc, &to, INTL_KEY_UNIQUE);
+				}
+				else
+				{
+					// This call ensures that the padding bytes are appended
+					MOV_move(tdbb, desc, &to);
+				}
+			}
+			else
+			{
+				const auto data = desc->dsc_address;
+
+				if (desc->isDecFloat())
+				{
+					// Values inside our key buffer are not aligned,
+					// so ensure we satisfy our platform's alignment rules
+					OutAligner<ULONG, MAX_DEC_KEY_LONGS> key(valuePtr, keyLength);
+
+					if (desc->dsc_dtype == dtype_dec64)
+						((Decimal64*) data)->makeKey(key);
+					else if (desc->dsc_dtype == dtype_dec128)
+						((Decimal128*) data)->makeKey(key);
+					else
+						fb_assert(false);
+				}
+				else if ((desc->dsc_dtype == dtype_real && *(float*) data == 0) ||
+					(desc->dsc_dtype == dtype_double && *(double*) data == 0))
+				{
+					// Positive zero in binary, it's already zeroed
+				}
+				else
+				{
+					// Note: for date/time with time zone, we copy only the UTC part.
+					fb_assert(keyLength <= desc->dsc_length);
+					memcpy(valuePtr, data, keyLength);
+				}
+			}
+		}
+
+		keyPtr += 1 + keyLength;
+	}
+
+	fb_assert(keyPtr - keyBuffer == m_keyLength);
+
+	return InternalHash::hash(m_keyLength, keyBuffer);
+}
+
+// Aggregate the current record of the underlying stream
+void HashAggregatedStream::aggregate(thread_db* tdbb, jrd_req* request, GroupTable* groups) const
+{
+	UCHAR* const key = groups->getKeyBuffer();
+	const ULONG hash = computeKey(tdbb, request, key);
+
+	UCHAR* group = groups->find(hash, key);
+
+	if (group)
+	{
+		restoreState(request, group);
+		aggPass(tdbb, request, m_groupMap->sourceList, m_groupMap->targetList);
+	}
+	else if (groups->isFull())
+	{
+		spill(tdbb, request, groups, hash, key);
+		return;
+	}
+	else
+	{
+		group = groups->add(hash, key);
+
+		aggInit(tdbb, request, m_groupMap);
+		aggPass(tdbb, request, m_groupMap->sourceList, m_groupMap->targetList);
+
+		// The group values are the same for every record of the group,
+		// so the aggregate record is saved just once
+		memcpy(group + m_stateLength, request->req_rpb[m_stream].rpb_record->getData(),
+			m_format->fmt_length);
+	}
+
+	saveState(request, group);
+}
+
+// Aggregate the record read from the spilled partition
+void HashAggregatedStream::aggregateSpilled(thread_db* tdbb, jrd_req* request,
+	GroupTable* groups, const UCHAR* data) const
+{
+	ULONG hash;
+	memcpy(&hash, data, sizeof(ULONG));
+	const UCHAR* const key = data + sizeof(ULONG);
+
+	UCHAR* group = groups->find(hash, key);
+
+	if (group)
+		restoreState(request, group);
+	else if (groups->isFull())
+	{
+		groups->spill(hash, data);
+		return;
+	}
+	else
+	{
+		group = groups->add(hash, key);
+
+		Record* const record = request->req_rpb[m_stream].rpb_record;
+		memcpy(record->getData(), key + m_keyLength, m_format->fmt_length);
+
+		aggInit(tdbb, request, m_groupMap);
+
+		memcpy(group + m_stateLength, record->getData(), m_format->fmt_length);
+	}
+
+	for (const SpilledArgument* argument = m_arguments.begin();
+		 argument != m_arguments.end();
+		 ++argument)
+	{
+		if (data[argument->nullOffset])
+			continue;
+
+		if (argument->aggNode->arg)
+		{
+			dsc desc = argument->desc;
+			desc.dsc_address = const_cast<UCHAR*>(data) + (IPTR) argument->desc.dsc_address;
+			argument->aggNode->aggPass(tdbb, request, &desc);
+		}
+		else
+			argument->aggNode->aggPass(tdbb, request, NULL);
+	}
+
+	saveState(request, group);
+}
+
+// Spill the current record of the underlying stream, as it doesn't belong to any of the groups
+void HashAggregatedStream::spill(thread_db* tdbb, jrd_req* request, GroupTable* groups,
+	ULONG hash, const UCHAR* key) const
+{
+	UCHAR* const data = groups->getSpillBuffer();
+
+	memcpy(data, &hash, sizeof(ULONG));
+	memcpy(data + sizeof(ULONG), key, m_keyLength);
+
+	// Evaluate everything but the aggregates into the aggregate record
+
+	const NestConst<ValueExprNode>* const sourceEnd = m_groupMap->sourceList.end();
+
+	for (const NestConst<ValueExprNode>* source = m_groupMap->sourceList.begin(),
+			*target = m_groupMap->targetList.begin();
+		 source != sourceEnd;
+		 ++source, ++target)
+	{
+		if (!nodeIs<AggNode>(*source))
+			EXE_assignment(tdbb, *source, *target);
+	}
+
+	memcpy(data + sizeof(ULONG) + m_keyLength, request->req_rpb[m_stream].rpb_record->getData(),
+		m_format->fmt_length);
+
+	// Evaluate the aggregate arguments
+
+	for (const SpilledArgument* argument = m_arguments.begin();
+		 argument != m_arguments.end();
+		 ++argument)
+	{
+		data[argument->nullOffset] = 0;
+
+		if (argument->aggNode->arg)
+		{
+			dsc* const desc = EVL_expr(tdbb, request, argument->aggNode->arg);
+
+			if (!desc || (request->req_flags & req_null))
+				data[argument->nullOffset] = 1;
+			else
+			{
+				dsc to = argument->desc;
+				to.dsc_address = data + (IPTR) argument->desc.dsc_address;
+				MOV_move(tdbb, desc, &to);
+			}
+		}
+	}
+
+	groups->spill(hash, data);
+}
+
+void HashAggregatedStream::saveState(jrd_req* request, UCHAR* state) const
+{
+	for (const ULONG* offset = m_stateOffsets.begin(); offset != m_stateOffsets.end(); ++offset)
+	{
+		memcpy(state, request->getImpure<UCHAR>(*offset), sizeof(impure_value_ex));
+		state += sizeof(impure_value_ex);
+	}
+}
+
+void HashAggregatedStream::restoreState(jrd_req* request, const UCHAR* state) const
+{
+	for (const ULONG* offset = m_stateOffsets.begin(); offset != m_stateOffsets.end(); ++offset)
+	{
+		memcpy(request->getImpure<UCHAR>(*offset), state, sizeof(impure_value_ex));
+		state += sizeof(impure_value_ex);
+	}
+}
@@ -44,8 +44,65 @@ using namespace Jrd;
 static const ULONG HASH_SIZE = 1009;
 static const ULONG BUCKET_PREALLOCATE_SIZE = 32;	// 256 bytes per slot
 
+static const ULONG MIN_FILTER_BITS = 1024;
+static const ULONG MAX_FILTER_BITS = 1 << 26;		// 8MB per stream
+static const ULONG FILTER_BITS_PER_ENTRY = 8;		// ~5% false positives with two probes
+
 class HashJoin::HashTable : public PermanentStorage
 {
+	// Bloom filter of the hashes stored for the stream. It's checked
+	// for the leading stream records while they're being scanned,
+	// so most of non-matching records are rejected as early as possible.
+
+	class BloomFilter
+	{
+	public:
+		BloomFilter(MemoryPool& pool, ULONG count)
+			: m_bits(pool)
+		{
+			ULONG size = MIN_FILTER_BITS;
+
+			while (size < MAX_FILTER_BITS && size < (FB_UINT64) count * FILTER_BITS_PER_ENTRY)
+				size <<= 1;
+
+			m_mask = size - 1;
+			memset(m_bits.getBuffer(size / 64), 0, size / 8);
+		}
+
+		void add(ULONG hash)
+		{
+			set(hash);
+			set(rehash(hash));
+		}
+
+		bool check(ULONG hash) const
+		{
+			return test(hash) && test(rehash(hash));
+		}
+
+	private:
+		static ULONG rehash(ULONG hash)
+		{
+			hash *= 0x9E3779B1;
+			return hash ^ (hash >> 16);
+		}
+
+		void set(ULONG hash)
+		{
+			const ULONG bit = hash & m_mask;
+			m_bits[bit / 64] |= QUADCONST(1) << (bit % 64);
+		}
+
+		bool test(ULONG hash) const
+		{
+			const ULONG bit = hash & m_mask;
+			return (m_bits[bit / 64] & (QUADCONST(1) << (bit % 64))) != 0;
+		}
+
+		Array<FB_UINT64> m_bits;
+		ULONG m_mask;
+	};
+
 	class CollisionList
 	{
 		static const FB_SIZE_T INVALID_ITERATOR = FB_SIZE_T(~0);
@@ -87,6 +144,17 @@ class HashJoin::HashTable : public PermanentStorage
 			m_collisions.add(Entry(hash, position));
 		}
 
+		FB_SIZE_T getCount() const
+		{
+			return m_collisions.getCount();
+		}
+
+		void addTo(BloomFilter* filter) const
+		{
+			for (const auto& collision : m_collisions)
+				filter->add(collision.hash);
+		}
+
 		bool locate(ULONG hash)
 		{
 			if (m_collisions.find(hash, m_iterator))
@@ -121,7 +189,7 @@ class HashJoin::HashTable : public PermanentStorage
 public:
 	HashTable(MemoryPool& pool, ULONG streamCount, ULONG tableSize = HASH_SIZE)
 		: PermanentStorage(pool), m_streamCount(streamCount),
-		  m_tableSize(tableSize), m_slot(0)
+		  m_tableSize(tableSize), m_slot(0), m_filters(NULL)
 	{
 		m_collisions = FB_NEW_POOL(pool) CollisionList*[streamCount * tableSize];
 		memset(m_collisions, 0, streamCount * tableSize * sizeof(CollisionList*));
@@ -133,6 +201,14 @@ public:
 			delete m_collisions[i];
 
 		delete[] m_collisions;
+
+		if (m_filters)
+		{
+			for (ULONG i = 0; i < m_streamCount; i++)
+				delete m_filters[i];
+
+			delete[] m_filters;
+		}
 	}
 
 	void put(ULONG stream, ULONG hash, ULONG position)
@@ -199,11 +275,53 @@ public:
 		}
 	}
 
+	void buildFilters()
+	{
+		fb_assert(!m_filters);
+
+		m_filters = FB_NEW_POOL(getPool()) BloomFilter*[m_streamCount];
+		memset(m_filters, 0, m_streamCount * sizeof(BloomFilter*));
+
+		for (ULONG i = 0; i < m_streamCount; i++)
+		{
+			CollisionList** const collisions = m_collisions + i * m_tableSize;
+
+			ULONG count = 0;
+			for (ULONG slot = 0; slot < m_tableSize; slot++)
+			{
+				if (collisions[slot])
+					count += collisions[slot]->getCount();
+			}
+
+			m_filters[i] = FB_NEW_POOL(getPool()) BloomFilter(getPool(), count);
+
+			for (ULONG slot = 0; slot < m_tableSize; slot++)
+			{
+				if (collisions[slot])
+					collisions[slot]->addTo(m_filters[i]);
+			}
+		}
+	}
+
+	bool check(ULONG hash) const
+	{
+		fb_assert(m_filters);
+
+		for (ULONG i = 0; i < m_streamCount; i++)
+		{
+			if (!m_filters[i]->check(hash))
+				return false;
+		}
+
+		return true;
+	}
+
 private:
 	const ULONG m_streamCount;
 	const ULONG m_tableSize;
 	CollisionList** m_collisions;
 	ULONG m_slot;
+	BloomFilter** m_filters;
 };
 
 
@@ -279,9 +397,20 @@ HashJoin::HashJoin(thread_db* tdbb, CompilerScratch* csb, FB_SIZE_T count,
 
 		m_args.add(sub);
 	}
+
+	// If the leading keys depend on a single stream, let its scan (or the filter
+	// above it) reject the records which keys are not found in the hash tables,
+	// before the join processing is done for them.
+
+	SortedStreamList leaderStreams;
+	for (const auto key : *m_leader.keys)
+		key->collectStreams(csb, leaderStreams);
+
+	m_leaderFiltered = (leaderStreams.getCount() == 1) &&
+		m_leader.source->pushJoinFilter(this, leaderStreams[0]);
 }
 
-void HashJoin::open(thread_db* tdbb) const
+void HashJoin::internalOpen(thread_db* tdbb) const
 {
 	jrd_req* const request = tdbb->getRequest();
 	Impure* const impure = request->getImpure<Impure>(m_impure);
@@ -319,6 +448,9 @@ void HashJoin::open(thread_db* tdbb) const
 
 	impure->irsb_hash_table->sort();
 
+	if (m_leaderFiltered)
+		impure->irsb_hash_table->buildFilters();
+
 	m_leader.source->open(tdbb);
 }
 
@@ -346,7 +478,7 @@ void HashJoin::close(thread_db* tdbb) const
 	}
 }
 
-bool HashJoin::getRecord(thread_db* tdbb) const
+bool HashJoin::internalGetRecord(thread_db* tdbb) const
 {
 	JRD_reschedule(tdbb);
 
@@ -430,7 +562,7 @@ void HashJoin::print(thread_db* tdbb, string& plan, bool detailed, unsigned leve
 {
 	if (detailed)
 	{
-		plan += printIndent(++level) + "Hash Join (inner)";
+		plan += printIndent(++level) + "Hash Join (inner)" + printProfile(tdbb);
 
 		m_leader.source->print(tdbb, plan, true, level);
 
@@ -486,6 +618,18 @@ void HashJoin::nullRecords(thread_db* tdbb) const
 		m_args[i].source->nullRecords(tdbb);
 }
 
+bool HashJoin::checkFilter(thread_db* tdbb) const
+{
+	jrd_req* const request = tdbb->getRequest();
+	Impure* const impure = request->getImpure<Impure>(m_impure);
+
+	fb_assert(impure->irsb_flags & irsb_open);
+
+	const ULONG hash = computeHash(tdbb, request, m_leader, impure->irsb_leader_buffer);
+
+	return impure->irsb_hash_table->check(hash);
+}
+
 ULONG HashJoin::computeHash(thread_db* tdbb,
 							jrd_req* request,
 						    const SubStream& sub,
@@ -60,7 +60,7 @@ IndexTableScan::IndexTableScan(CompilerScratch* csb, const string& alias,
 	m_impure = csb->allocImpure(FB_ALIGNMENT, static_cast<ULONG>(size));
 }
 
-void IndexTableScan::open(thread_db* tdbb) const
+void IndexTableScan::internalOpen(thread_db* tdbb) const
 {
 	jrd_req* const request = tdbb->getRequest();
 	Impure* const impure = request->getImpure<Impure>(m_impure);
@@ -123,7 +123,7 @@ void IndexTableScan::close(thread_db* tdbb) const
 #endif
 }
 
-bool IndexTableScan::getRecord(thread_db* tdbb) const
+bool IndexTableScan::internalGetRecord(thread_db* tdbb) const
 {
 	JRD_reschedule(tdbb);
 
@@ -268,7 +268,8 @@ void IndexTableScan::print(thread_db* tdbb, string& plan, bool detailed, unsigne
 	if (detailed)
 	{
 		plan += printIndent(++level) + "Table " +
-			printName(tdbb, m_relation->rel_name.c_str(), m_alias) + " Access By ID";
+			printName(tdbb, m_relation->rel_name.c_str(), m_alias) + " Access By ID" +
+			printProfile(tdbb);
 
 		printInversion(tdbb, m_index, plan, true, level, true);
 
@@ -44,7 +44,7 @@ LocalTableStream::LocalTableStream(CompilerScratch* csb, StreamType stream, cons
 	m_impure = csb->allocImpure<Impure>();
 }
 
-void LocalTableStream::open(thread_db* tdbb) const
+void LocalTableStream::internalOpen(thread_db* tdbb) const
 {
 	const auto request = tdbb->getRequest();
 	const auto impure = request->getImpure<Impure>(m_impure);
@@ -69,7 +69,7 @@ void LocalTableStream::close(thread_db* tdbb) const
 		impure->irsb_flags &= ~irsb_open;
 }
 
-bool LocalTableStream::getRecord(thread_db* tdbb) const
+bool LocalTableStream::internalGetRecord(thread_db* tdbb) const
 {
 	JRD_reschedule(tdbb);
 
@@ -113,7 +113,7 @@ void LocalTableStream::print(thread_db* tdbb, string& plan, bool detailed, unsig
 	//// TODO: Use Local Table name/alias.
 
 	if (detailed)
-		plan += printIndent(++level) + "Local Table Full Scan";
+		plan += printIndent(++level) + "Local Table Full Scan" + printProfile(tdbb);
 	else
 	{
 		if (!level)
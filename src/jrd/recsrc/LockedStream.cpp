@@ -42,7 +42,7 @@ LockedStream::LockedStream(CompilerScratch* csb, RecordSource* next)
 	m_impure = csb->allocImpure<Impure>();
 }
 
-void LockedStream::open(thread_db* tdbb) const
+void LockedStream::internalOpen(thread_db* tdbb) const
 {
 	jrd_req* const request = tdbb->getRequest();
 	Impure* const impure = request->getImpure<Impure>(m_impure);
@@ -68,7 +68,7 @@ void LockedStream::close(thread_db* tdbb) const
 	}
 }
 
-bool LockedStream::getRecord(thread_db* tdbb) const
+bool LockedStream::internalGetRecord(thread_db* tdbb) const
 {
 	JRD_reschedule(tdbb);
 
@@ -105,7 +105,7 @@ bool LockedStream::lockRecord(thread_db* tdbb) const
 void LockedStream::print(thread_db* tdbb, string& plan, bool detailed, unsigned level) const
 {
 	if (detailed)
-		plan += printIndent(++level) + "Write Lock";
+		plan += printIndent(++level) + "Write Lock" + printProfile(tdbb);
 
 	m_next->print(tdbb, plan, detailed, level);
 }
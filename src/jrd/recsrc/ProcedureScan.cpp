@@ -53,7 +53,7 @@ ProcedureScan::ProcedureScan(CompilerScratch* csb, const string& alias, StreamTy
 		fb_assert(sourceList->items.getCount() == targetList->items.getCount());
 }
 
-void ProcedureScan::open(thread_db* tdbb) const
+void ProcedureScan::internalOpen(thread_db* tdbb) const
 {
 	if (!m_procedure->isImplemented())
 	{
@@ -159,7 +159,7 @@ void ProcedureScan::close(thread_db* tdbb) const
 	}
 }
 
-bool ProcedureScan::getRecord(thread_db* tdbb) const
+bool ProcedureScan::internalGetRecord(thread_db* tdbb) const
 {
 	JRD_reschedule(tdbb);
 
@@ -246,7 +246,8 @@ void ProcedureScan::print(thread_db* tdbb, string& plan, bool detailed, unsigned
 	if (detailed)
 	{
 		plan += printIndent(++level) + "Procedure " +
-			printName(tdbb, m_procedure->getName().toString(), m_alias) + " Scan";
+			printName(tdbb, m_procedure->getName().toString(), m_alias) + " Scan" +
+			printProfile(tdbb);
 	}
 	else
 	{
@@ -34,6 +34,7 @@
 #include "../jrd/rlck_proto.h"
 #include "../jrd/vio_proto.h"
 #include "../jrd/DataTypeUtil.h"
+#include "../common/utils_proto.h"
 
 #include "RecordSource.h"
 
@@ -44,6 +45,81 @@ using namespace Jrd;
 // Record source class
 // -------------------
 
+// When the request is being profiled, open() and getRecord() accumulate the elapsed
+// time and the number of returned records in the impure area. The counters are
+// reset lazily, on the first call within every new request run.
+
+void RecordSource::open(thread_db* tdbb) const
+{
+	jrd_req* const request = tdbb->getRequest();
+
+	if (!(request->req_flags & req_profile))
+	{
+		internalOpen(tdbb);
+		return;
+	}
+
+	Impure* const impure = getProfileImpure(request);
+	const SINT64 start = fb_utils::query_performance_counter();
+	internalOpen(tdbb);
+	impure->irsb_profile_ticks += fb_utils::query_performance_counter() - start;
+}
+
+bool RecordSource::getRecord(thread_db* tdbb) const
+{
+	jrd_req* const request = tdbb->getRequest();
+
+	if (!(request->req_flags & req_profile))
+		return internalGetRecord(tdbb);
+
+	Impure* const impure = getProfileImpure(request);
+	const SINT64 start = fb_utils::query_performance_counter();
+	const bool result = internalGetRecord(tdbb);
+	impure->irsb_profile_ticks += fb_utils::query_performance_counter() - start;
+
+	if (result)
+		impure->irsb_profile_rows++;
+
+	return result;
+}
+
+RecordSource::Impure* RecordSource::getProfileImpure(jrd_req* request) const
+{
+	Impure* const impure = request->getImpure<Impure>(m_impure);
+
+	if (impure->irsb_profile_run != request->req_profile_run)
+	{
+		impure->irsb_profile_run = request->req_profile_run;
+		impure->irsb_profile_rows = 0;
+		impure->irsb_profile_ticks = 0;
+	}
+
+	return impure;
+}
+
+string RecordSource::printProfile(thread_db* tdbb) const
+{
+	string result;
+
+	jrd_req* const request = tdbb->getRequest();
+
+	if (!request || !request->req_profile_run)
+		return result;
+
+	const Impure* const impure = request->getImpure<Impure>(m_impure);
+
+	if (impure->irsb_profile_run == request->req_profile_run)
+	{
+		const double elapsed = (double) impure->irsb_profile_ticks * 1000 /
+			fb_utils::query_performance_frequency();
+
+		result.printf(" (rows: %" UQUADFORMAT", elapsed: %.3f ms)",
+			impure->irsb_profile_rows, elapsed);
+	}
+
+	return result;
+}
+
 string RecordSource::printName(thread_db* tdbb, const string& name, bool quote)
 {
 	const UCHAR* namePtr = (const UCHAR*) name.c_str();
@@ -141,9 +217,10 @@ void RecordSource::printInversion(thread_db* tdbb, const InversionNode* inversio
 
 				const bool equality = (retrieval->irb_generic & irb_equality);
 				const bool partial = (retrieval->irb_generic & irb_partial);
+				const bool skip = (retrieval->irb_generic & irb_skip_scan);
 
 				const bool fullscan = (maxSegs == 0);
-				const bool unique = uniqueIdx && equality && (minSegs == segCount);
+				const bool unique = uniqueIdx && equality && !skip && (minSegs == segCount);
 
 				string bounds;
 				if (!unique && !fullscan)
@@ -177,7 +254,7 @@ void RecordSource::printInversion(thread_db* tdbb, const InversionNode* inversio
 				}
 
 				plan += "Index " + printName(tdbb, indexName.c_str()) +
-					(fullscan ? " Full" : unique ? " Unique" : " Range") + " Scan" + bounds;
+					(fullscan ? " Full" : unique ? " Unique" : skip ? " Skip" : " Range") + " Scan" + bounds;
 			}
 			else
 			{
@@ -50,6 +50,7 @@ namespace Jrd
 	struct win;
 	class BaseBufferedStream;
 	class BufferedStream;
+	class HashJoin;
 
 	enum JoinType { INNER_JOIN, OUTER_JOIN, SEMI_JOIN, ANTI_JOIN };
 
@@ -58,10 +59,10 @@ namespace Jrd
 	class RecordSource
 	{
 	public:
-		virtual void open(thread_db* tdbb) const = 0;
+		void open(thread_db* tdbb) const;
 		virtual void close(thread_db* tdbb) const = 0;
 
-		virtual bool getRecord(thread_db* tdbb) const = 0;
+		bool getRecord(thread_db* tdbb) const;
 		virtual bool refetchRecord(thread_db* tdbb) const = 0;
 		virtual bool lockRecord(thread_db* tdbb) const = 0;
 
@@ -79,6 +80,18 @@ namespace Jrd
 			fb_assert(false);
 		}
 
+		// Let the scan of the given stream reject the records
+		// not matching the hash join built above it
+		virtual bool pushJoinFilter(const HashJoin* /*join*/, StreamType /*stream*/)
+		{
+			return false;
+		}
+
+		// Let the stream know that no more than the given number of its records
+		// are going to be fetched after being opened next time
+		virtual void setRowLimit(jrd_req* /*request*/, FB_UINT64 /*rows*/) const
+		{}
+
 		virtual ~RecordSource();
 
 		static bool rejectDuplicate(const UCHAR* /*data1*/, const UCHAR* /*data2*/, void* /*userArg*/)
@@ -91,6 +104,9 @@ namespace Jrd
 		struct Impure
 		{
 			ULONG irsb_flags;
+			ULONG irsb_profile_run;			// request run the profile counters belong to
+			FB_UINT64 irsb_profile_rows;	// records returned
+			SINT64 irsb_profile_ticks;		// clock ticks spent in open() and getRecord()
 		};
 
 		static const ULONG irsb_open = 1;
@@ -103,6 +119,11 @@ namespace Jrd
 			: m_impure(0), m_recursive(false)
 		{}
 
+		virtual void internalOpen(thread_db* tdbb) const = 0;
+		virtual bool internalGetRecord(thread_db* tdbb) const = 0;
+
+		Firebird::string printProfile(thread_db* tdbb) const;
+
 		static Firebird::string printName(thread_db* tdbb, const Firebird::string& name, bool quote = true);
 		static Firebird::string printName(thread_db* tdbb, const Firebird::string& name,
 										  const Firebird::string& alias);
@@ -117,6 +138,9 @@ namespace Jrd
 
 		ULONG m_impure;
 		bool m_recursive;
+
+	private:
+		Impure* getProfileImpure(jrd_req* request) const;
 	};
 
 
@@ -150,6 +174,10 @@ namespace Jrd
 		{
 			RecordNumber irsb_lower;
 			RecordNumber irsb_upper;
+			FB_UINT64 irsb_range_generation;	// block ranges cache generation for the next pointer page
+			ULONG irsb_range_pp;				// pointer page being scanned
+			bool irsb_range_entered;			// irsb_range_pp is valid
+			bool irsb_range_collect;			// summaries of irsb_range_pp are being collected
 		};
 
 	public:
@@ -157,18 +185,29 @@ namespace Jrd
 					  StreamType stream, jrd_rel* relation,
 					  const Firebird::Array<DbKeyRangeNode*>& dbkeyRanges);
 
-		void open(thread_db* tdbb) const override;
+		void internalOpen(thread_db* tdbb) const override;
 		void close(thread_db* tdbb) const override;
 
-		bool getRecord(thread_db* tdbb) const override;
+		bool internalGetRecord(thread_db* tdbb) const override;
 
 		void print(thread_db* tdbb, Firebird::string& plan,
 				   bool detailed, unsigned level) const override;
 
+		void setBlockRanges(CompilerScratch* csb, const Firebird::Array<BlockRangeNode*>& blockRanges);
+
+		bool pushJoinFilter(const HashJoin* join, StreamType stream) override;
+
 	private:
+		bool enterRange(thread_db* tdbb, Impure* impure, ULONG ppSequence) const;
+		void collectRange(thread_db* tdbb, Impure* impure) const;
+		void finishRange(thread_db* tdbb, Impure* impure) const;
+
 		const Firebird::string m_alias;
 		jrd_rel* const m_relation;
 		Firebird::Array<DbKeyRangeNode*> m_dbkeyRanges;
+		Firebird::Array<BlockRangeNode*> m_blockRanges;
+		ULONG m_rangeImpure;
+		const HashJoin* m_joinFilter;
 	};
 
 	class BitmapTableScan : public RecordStream
@@ -182,10 +221,10 @@ namespace Jrd
 		BitmapTableScan(CompilerScratch* csb, const Firebird::string& alias,
 						StreamType stream, jrd_rel* relation, InversionNode* inversion);
 
-		void open(thread_db* tdbb) const override;
+		void internalOpen(thread_db* tdbb) const override;
 		void close(thread_db* tdbb) const override;
 
-		bool getRecord(thread_db* tdbb) const override;
+		bool internalGetRecord(thread_db* tdbb) const override;
 
 		void print(thread_db* tdbb, Firebird::string& plan,
 				   bool detailed, unsigned level) const override;
@@ -217,10 +256,10 @@ namespace Jrd
 					   StreamType stream, jrd_rel* relation,
 					   InversionNode* index, USHORT keyLength);
 
-		void open(thread_db* tdbb) const override;
+		void internalOpen(thread_db* tdbb) const override;
 		void close(thread_db* tdbb) const override;
 
-		bool getRecord(thread_db* tdbb) const override;
+		bool internalGetRecord(thread_db* tdbb) const override;
 
 		void print(thread_db* tdbb, Firebird::string& plan,
 				   bool detailed, unsigned level) const override;
@@ -262,10 +301,10 @@ namespace Jrd
 		ExternalTableScan(CompilerScratch* csb, const Firebird::string& alias,
 						  StreamType stream, jrd_rel* relation);
 
-		void open(thread_db* tdbb) const override;
+		void internalOpen(thread_db* tdbb) const override;
 		void close(thread_db* tdbb) const override;
 
-		bool getRecord(thread_db* tdbb) const override;
+		bool internalGetRecord(thread_db* tdbb) const override;
 		bool refetchRecord(thread_db* tdbb) const override;
 		bool lockRecord(thread_db* tdbb) const override;
 
@@ -283,10 +322,10 @@ namespace Jrd
 		VirtualTableScan(CompilerScratch* csb, const Firebird::string& alias,
 						 StreamType stream, jrd_rel* relation);
 
-		void open(thread_db* tdbb) const override;
+		void internalOpen(thread_db* tdbb) const override;
 		void close(thread_db* tdbb) const override;
 
-		bool getRecord(thread_db* tdbb) const override;
+		bool internalGetRecord(thread_db* tdbb) const override;
 		bool refetchRecord(thread_db* tdbb) const override;
 		bool lockRecord(thread_db* tdbb) const override;
 
@@ -316,10 +355,10 @@ namespace Jrd
 					  const jrd_prc* procedure, const ValueListNode* sourceList,
 					  const ValueListNode* targetList, MessageNode* message);
 
-		void open(thread_db* tdbb) const override;
+		void internalOpen(thread_db* tdbb) const override;
 		void close(thread_db* tdbb) const override;
 
-		bool getRecord(thread_db* tdbb) const override;
+		bool internalGetRecord(thread_db* tdbb) const override;
 		bool refetchRecord(thread_db* tdbb) const override;
 		bool lockRecord(thread_db* tdbb) const override;
 
@@ -345,10 +384,10 @@ namespace Jrd
 	public:
 		SingularStream(CompilerScratch* csb, RecordSource* next);
 
-		void open(thread_db* tdbb) const override;
+		void internalOpen(thread_db* tdbb) const override;
 		void close(thread_db* tdbb) const override;
 
-		bool getRecord(thread_db* tdbb) const override;
+		bool internalGetRecord(thread_db* tdbb) const override;
 		bool refetchRecord(thread_db* tdbb) const override;
 		bool lockRecord(thread_db* tdbb) const override;
 
@@ -373,10 +412,10 @@ namespace Jrd
 	public:
 		LockedStream(CompilerScratch* csb, RecordSource* next);
 
-		void open(thread_db* tdbb) const override;
+		void internalOpen(thread_db* tdbb) const override;
 		void close(thread_db* tdbb) const override;
 
-		bool getRecord(thread_db* tdbb) const override;
+		bool internalGetRecord(thread_db* tdbb) const override;
 		bool refetchRecord(thread_db* tdbb) const override;
 		bool lockRecord(thread_db* tdbb) const override;
 
@@ -403,10 +442,10 @@ namespace Jrd
 	public:
 		FirstRowsStream(CompilerScratch* csb, RecordSource* next, ValueExprNode* value);
 
-		void open(thread_db* tdbb) const override;
+		void internalOpen(thread_db* tdbb) const override;
 		void close(thread_db* tdbb) const override;
 
-		bool getRecord(thread_db* tdbb) const override;
+		bool internalGetRecord(thread_db* tdbb) const override;
 		bool refetchRecord(thread_db* tdbb) const override;
 		bool lockRecord(thread_db* tdbb) const override;
 
@@ -434,15 +473,16 @@ namespace Jrd
 		struct Impure : public RecordSource::Impure
 		{
 			SINT64 irsb_count;
+			FB_UINT64 irsb_limit;
 		};
 
 	public:
 		SkipRowsStream(CompilerScratch* csb, RecordSource* next, ValueExprNode* value);
 
-		void open(thread_db* tdbb) const override;
+		void internalOpen(thread_db* tdbb) const override;
 		void close(thread_db* tdbb) const override;
 
-		bool getRecord(thread_db* tdbb) const override;
+		bool internalGetRecord(thread_db* tdbb) const override;
 		bool refetchRecord(thread_db* tdbb) const override;
 		bool lockRecord(thread_db* tdbb) const override;
 
@@ -460,6 +500,8 @@ namespace Jrd
 			m_next->setAnyBoolean(anyBoolean, ansiAny, ansiNot);
 		}
 
+		void setRowLimit(jrd_req* request, FB_UINT64 rows) const override;
+
 	private:
 		NestConst<RecordSource> m_next;
 		NestConst<ValueExprNode> const m_value;
@@ -470,10 +512,10 @@ namespace Jrd
 	public:
 		FilteredStream(CompilerScratch* csb, RecordSource* next, BoolExprNode* boolean);
 
-		void open(thread_db* tdbb) const override;
+		void internalOpen(thread_db* tdbb) const override;
 		void close(thread_db* tdbb) const override;
 
-		bool getRecord(thread_db* tdbb) const override;
+		bool internalGetRecord(thread_db* tdbb) const override;
 		bool refetchRecord(thread_db* tdbb) const override;
 		bool lockRecord(thread_db* tdbb) const override;
 
@@ -496,6 +538,8 @@ namespace Jrd
 			m_ansiNot = ansiNot;
 		}
 
+		bool pushJoinFilter(const HashJoin* join, StreamType stream) override;
+
 	private:
 		bool evaluateBoolean(thread_db* tdbb) const;
 
@@ -505,6 +549,7 @@ namespace Jrd
 		bool m_ansiAny;
 		bool m_ansiAll;
 		bool m_ansiNot;
+		const HashJoin* m_joinFilter;
 	};
 
 	class SortedStream : public RecordSource
@@ -512,6 +557,7 @@ namespace Jrd
 		struct Impure : public RecordSource::Impure
 		{
 			Sort* irsb_sort;
+			FB_UINT64 irsb_limit;
 		};
 
 	public:
@@ -565,10 +611,10 @@ namespace Jrd
 
 		SortedStream(CompilerScratch* csb, RecordSource* next, SortMap* map);
 
-		void open(thread_db* tdbb) const override;
+		void internalOpen(thread_db* tdbb) const override;
 		void close(thread_db* tdbb) const override;
 
-		bool getRecord(thread_db* tdbb) const override;
+		bool internalGetRecord(thread_db* tdbb) const override;
 		bool refetchRecord(thread_db* tdbb) const override;
 		bool lockRecord(thread_db* tdbb) const override;
 
@@ -586,6 +632,8 @@ namespace Jrd
 			m_next->setAnyBoolean(anyBoolean, ansiAny, ansiNot);
 		}
 
+		void setRowLimit(jrd_req* request, FB_UINT64 rows) const override;
+
 		ULONG getLength() const
 		{
 			return m_map->length;
@@ -708,7 +756,7 @@ namespace Jrd
 			const NestValueArray* group, MapNode* groupMap, bool oneRowWhenEmpty, NextType* next);
 
 	public:
-		void open(thread_db* tdbb) const override;
+		void internalOpen(thread_db* tdbb) const override;
 		void close(thread_db* tdbb) const override;
 
 		bool refetchRecord(thread_db* tdbb) const override;
@@ -785,7 +833,72 @@ namespace Jrd
 
 	public:
 		void print(thread_db* tdbb, Firebird::string& plan, bool detailed, unsigned level) const;
-		bool getRecord(thread_db* tdbb) const;
+		bool internalGetRecord(thread_db* tdbb) const;
+	};
+
+	// Aggregation looking up the groups in a hash table rather than reading
+	// the input sorted by the group keys, so the groups are returned unordered.
+	// If the table grows too large, the records of the groups not fitting it
+	// are spilled into the temporary space partitions to be aggregated later.
+
+	class HashAggregatedStream : public BaseAggWinStream<HashAggregatedStream, RecordSource>
+	{
+		class GroupTable;
+
+		struct SpilledArgument
+		{
+			const AggNode* aggNode;
+			ULONG nullOffset;		// NULL flag inside the spilled record
+			dsc desc;				// argument value inside the spilled record
+		};
+
+	public:
+		struct Impure : public BaseAggWinStream::Impure
+		{
+			GroupTable* irsb_groups;
+			ULONG irsb_position;	// next group to be returned
+		};
+
+		static const ULONG MAX_ESTIMATED_GROUPS = 10000;
+		static const ULONG MAX_KEY_LENGTH = 1024;
+
+		HashAggregatedStream(thread_db* tdbb, CompilerScratch* csb, StreamType stream,
+			NestValueArray* group, MapNode* map, RecordSource* next);
+
+		static bool isSupported(thread_db* tdbb, CompilerScratch* csb,
+			NestValueArray* group, MapNode* map);
+
+		void internalOpen(thread_db* tdbb) const override;
+		void close(thread_db* tdbb) const override;
+
+		void print(thread_db* tdbb, Firebird::string& plan, bool detailed, unsigned level) const override;
+		bool internalGetRecord(thread_db* tdbb) const override;
+
+	protected:
+		Impure* getImpure(jrd_req* request) const
+		{
+			return request->getImpure<Impure>(m_impure);
+		}
+
+	private:
+		static USHORT getKeyLength(thread_db* tdbb, const dsc* desc);
+
+		ULONG computeKey(thread_db* tdbb, jrd_req* request, UCHAR* keyBuffer) const;
+		void aggregate(thread_db* tdbb, jrd_req* request, GroupTable* groups) const;
+		void aggregateSpilled(thread_db* tdbb, jrd_req* request, GroupTable* groups,
+			const UCHAR* data) const;
+		void spill(thread_db* tdbb, jrd_req* request, GroupTable* groups,
+			ULONG hash, const UCHAR* key) const;
+
+		void saveState(jrd_req* request, UCHAR* state) const;
+		void restoreState(jrd_req* request, const UCHAR* state) const;
+
+		Firebird::Array<USHORT> m_keyLengths;
+		Firebird::Array<ULONG> m_stateOffsets;
+		Firebird::Array<SpilledArgument> m_arguments;
+		ULONG m_keyLength;
+		ULONG m_stateLength;
+		ULONG m_spillLength;
 	};
 
 	class WindowedStream : public RecordSource
@@ -844,10 +957,10 @@ namespace Jrd
 				WindowClause::Exclusion exclusion);
 
 		public:
-			void open(thread_db* tdbb) const;
+			void internalOpen(thread_db* tdbb) const;
 			void close(thread_db* tdbb) const;
 
-			bool getRecord(thread_db* tdbb) const;
+			bool internalGetRecord(thread_db* tdbb) const;
 
 			void print(thread_db* tdbb, Firebird::string& plan, bool detailed, unsigned level) const;
 			void findUsedStreams(StreamList& streams, bool expandAll = false) const;
@@ -881,10 +994,10 @@ namespace Jrd
 		WindowedStream(thread_db* tdbb, CompilerScratch* csb,
 			Firebird::ObjectsArray<WindowSourceNode::Window>& windows, RecordSource* next);
 
-		void open(thread_db* tdbb) const override;
+		void internalOpen(thread_db* tdbb) const override;
 		void close(thread_db* tdbb) const override;
 
-		bool getRecord(thread_db* tdbb) const override;
+		bool internalGetRecord(thread_db* tdbb) const override;
 		bool refetchRecord(thread_db* tdbb) const override;
 		bool lockRecord(thread_db* tdbb) const override;
 
@@ -941,10 +1054,10 @@ namespace Jrd
 	public:
 		BufferedStream(CompilerScratch* csb, RecordSource* next);
 
-		void open(thread_db* tdbb) const override;
+		void internalOpen(thread_db* tdbb) const override;
 		void close(thread_db* tdbb) const override;
 
-		bool getRecord(thread_db* tdbb) const override;
+		bool internalGetRecord(thread_db* tdbb) const override;
 		bool refetchRecord(thread_db* tdbb) const override;
 		bool lockRecord(thread_db* tdbb) const override;
 
@@ -981,10 +1094,10 @@ namespace Jrd
 		NestedLoopJoin(CompilerScratch* csb, RecordSource* outer, RecordSource* inner,
 					   BoolExprNode* boolean, JoinType joinType);
 
-		void open(thread_db* tdbb) const override;
+		void internalOpen(thread_db* tdbb) const override;
 		void close(thread_db* tdbb) const override;
 
-		bool getRecord(thread_db* tdbb) const override;
+		bool internalGetRecord(thread_db* tdbb) const override;
 		bool refetchRecord(thread_db* tdbb) const override;
 		bool lockRecord(thread_db* tdbb) const override;
 
@@ -1010,10 +1123,10 @@ namespace Jrd
 	public:
 		FullOuterJoin(CompilerScratch* csb, RecordSource* arg1, RecordSource* arg2);
 
-		void open(thread_db* tdbb) const override;
+		void internalOpen(thread_db* tdbb) const override;
 		void close(thread_db* tdbb) const override;
 
-		bool getRecord(thread_db* tdbb) const override;
+		bool internalGetRecord(thread_db* tdbb) const override;
 		bool refetchRecord(thread_db* tdbb) const override;
 		bool lockRecord(thread_db* tdbb) const override;
 
@@ -1059,10 +1172,10 @@ namespace Jrd
 		HashJoin(thread_db* tdbb, CompilerScratch* csb, FB_SIZE_T count,
 				 RecordSource* const* args, NestValueArray* const* keys);
 
-		void open(thread_db* tdbb) const override;
+		void internalOpen(thread_db* tdbb) const override;
 		void close(thread_db* tdbb) const override;
 
-		bool getRecord(thread_db* tdbb) const override;
+		bool internalGetRecord(thread_db* tdbb) const override;
 		bool refetchRecord(thread_db* tdbb) const override;
 		bool lockRecord(thread_db* tdbb) const override;
 
@@ -1075,6 +1188,8 @@ namespace Jrd
 		void findUsedStreams(StreamList& streams, bool expandAll = false) const override;
 		void nullRecords(thread_db* tdbb) const override;
 
+		bool checkFilter(thread_db* tdbb) const;
+
 	private:
 		ULONG computeHash(thread_db* tdbb, jrd_req* request,
 						  const SubStream& sub, UCHAR* buffer) const;
@@ -1082,6 +1197,7 @@ namespace Jrd
 
 		SubStream m_leader;
 		Firebird::Array<SubStream> m_args;
+		bool m_leaderFiltered;
 	};
 
 	class MergeJoin : public RecordSource
@@ -1119,10 +1235,10 @@ namespace Jrd
 				  SortedStream* const* args,
 				  const NestValueArray* const* keys);
 
-		void open(thread_db* tdbb) const override;
+		void internalOpen(thread_db* tdbb) const override;
 		void close(thread_db* tdbb) const override;
 
-		bool getRecord(thread_db* tdbb) const override;
+		bool internalGetRecord(thread_db* tdbb) const override;
 		bool refetchRecord(thread_db* tdbb) const override;
 		bool lockRecord(thread_db* tdbb) const override;
 
@@ -1151,10 +1267,10 @@ namespace Jrd
 	public:
 		LocalTableStream(CompilerScratch* csb, StreamType stream, const DeclareLocalTableNode* table);
 
-		void open(thread_db* tdbb) const override;
+		void internalOpen(thread_db* tdbb) const override;
 		void close(thread_db* tdbb) const override;
 
-		bool getRecord(thread_db* tdbb) const override;
+		bool internalGetRecord(thread_db* tdbb) const override;
 		bool refetchRecord(thread_db* tdbb) const override;
 		bool lockRecord(thread_db* tdbb) const override;
 
@@ -1176,10 +1292,10 @@ namespace Jrd
 			  FB_SIZE_T argCount, RecordSource* const* args, NestConst<MapNode>* maps,
 			  FB_SIZE_T streamCount, const StreamType* streams);
 
-		void open(thread_db* tdbb) const override;
+		void internalOpen(thread_db* tdbb) const override;
 		void close(thread_db* tdbb) const override;
 
-		bool getRecord(thread_db* tdbb) const override;
+		bool internalGetRecord(thread_db* tdbb) const override;
 		bool refetchRecord(thread_db* tdbb) const override;
 		bool lockRecord(thread_db* tdbb) const override;
 
@@ -1217,10 +1333,10 @@ namespace Jrd
 					    FB_SIZE_T streamCount, const StreamType* innerStreams,
 					    ULONG saveOffset);
 
-		void open(thread_db* tdbb) const override;
+		void internalOpen(thread_db* tdbb) const override;
 		void close(thread_db* tdbb) const override;
 
-		bool getRecord(thread_db* tdbb) const override;
+		bool internalGetRecord(thread_db* tdbb) const override;
 		bool refetchRecord(thread_db* tdbb) const override;
 		bool lockRecord(thread_db* tdbb) const override;
 
@@ -1255,10 +1371,10 @@ namespace Jrd
 		ConditionalStream(CompilerScratch* csb, RecordSource* first, RecordSource* second,
 						  BoolExprNode* boolean);
 
-		void open(thread_db* tdbb) const override;
+		void internalOpen(thread_db* tdbb) const override;
 		void close(thread_db* tdbb) const override;
 
-		bool getRecord(thread_db* tdbb) const override;
+		bool internalGetRecord(thread_db* tdbb) const override;
 		bool refetchRecord(thread_db* tdbb) const override;
 		bool lockRecord(thread_db* tdbb) const override;
 
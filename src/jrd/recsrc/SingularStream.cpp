@@ -42,7 +42,7 @@ SingularStream::SingularStream(CompilerScratch* csb, RecordSource* next)
 	m_impure = csb->allocImpure<Impure>();
 }
 
-void SingularStream::open(thread_db* tdbb) const
+void SingularStream::internalOpen(thread_db* tdbb) const
 {
 	jrd_req* const request = tdbb->getRequest();
 	Impure* const impure = request->getImpure<Impure>(m_impure);
@@ -68,7 +68,7 @@ void SingularStream::close(thread_db* tdbb) const
 	}
 }
 
-bool SingularStream::getRecord(thread_db* tdbb) const
+bool SingularStream::internalGetRecord(thread_db* tdbb) const
 {
 	JRD_reschedule(tdbb);
 
@@ -145,7 +145,7 @@ bool SingularStream::lockRecord(thread_db* tdbb) const
 void SingularStream::print(thread_db* tdbb, string& plan, bool detailed, unsigned level) const
 {
 	if (detailed)
-		plan += printIndent(++level) + "Singularity Check";
+		plan += printIndent(++level) + "Singularity Check" + printProfile(tdbb);
 
 	m_next->print(tdbb, plan, detailed, level);
 }
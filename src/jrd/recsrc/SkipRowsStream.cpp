@@ -44,7 +44,7 @@ SkipRowsStream::SkipRowsStream(CompilerScratch* csb, RecordSource* next, ValueEx
 	m_impure = csb->allocImpure<Impure>();
 }
 
-void SkipRowsStream::open(thread_db* tdbb) const
+void SkipRowsStream::internalOpen(thread_db* tdbb) const
 {
 	jrd_req* const request = tdbb->getRequest();
 	Impure* const impure = request->getImpure<Impure>(m_impure);
@@ -61,6 +61,14 @@ void SkipRowsStream::open(thread_db* tdbb) const
 
 	impure->irsb_count = value + 1;
 
+	// The rows being skipped are fetched as well
+
+	if (impure->irsb_limit)
+	{
+		m_next->setRowLimit(request, impure->irsb_limit + value);
+		impure->irsb_limit = 0;
+	}
+
 	m_next->open(tdbb);
 }
 
@@ -80,7 +88,7 @@ void SkipRowsStream::close(thread_db* tdbb) const
 	}
 }
 
-bool SkipRowsStream::getRecord(thread_db* tdbb) const
+bool SkipRowsStream::internalGetRecord(thread_db* tdbb) const
 {
 	JRD_reschedule(tdbb);
 
@@ -116,7 +124,7 @@ bool SkipRowsStream::lockRecord(thread_db* tdbb) const
 void SkipRowsStream::print(thread_db* tdbb, string& plan, bool detailed, unsigned level) const
 {
 	if (detailed)
-		plan += printIndent(++level) + "Skip N Records";
+		plan += printIndent(++level) + "Skip N Records" + printProfile(tdbb);
 
 	m_next->print(tdbb, plan, detailed, level);
 }
@@ -140,3 +148,9 @@ void SkipRowsStream::nullRecords(thread_db* tdbb) const
 {
 	m_next->nullRecords(tdbb);
 }
+
+void SkipRowsStream::setRowLimit(jrd_req* request, FB_UINT64 rows) const
+{
+	Impure* const impure = request->getImpure<Impure>(m_impure);
+	impure->irsb_limit = rows;
+}
@@ -50,7 +50,7 @@ SortedStream::SortedStream(CompilerScratch* csb, RecordSource* next, SortMap* ma
 	m_impure = csb->allocImpure<Impure>();
 }
 
-void SortedStream::open(thread_db* tdbb) const
+void SortedStream::internalOpen(thread_db* tdbb) const
 {
 	jrd_req* const request = tdbb->getRequest();
 	Impure* const impure = request->getImpure<Impure>(m_impure);
@@ -84,7 +84,7 @@ void SortedStream::close(thread_db* tdbb) const
 	}
 }
 
-bool SortedStream::getRecord(thread_db* tdbb) const
+bool SortedStream::internalGetRecord(thread_db* tdbb) const
 {
 	JRD_reschedule(tdbb);
 
@@ -127,7 +127,8 @@ void SortedStream::print(thread_db* tdbb, string& plan,
 			plan += printIndent(++level) + "Refetch";
 
 		plan += printIndent(++level) +
-			((m_map->flags & FLAG_PROJECT) ? "Unique Sort" : "Sort") + extras;
+			((m_map->flags & FLAG_PROJECT) ? "Unique Sort" : "Sort") + extras +
+			printProfile(tdbb);
 
 		m_next->print(tdbb, plan, true, level);
 	}
@@ -160,9 +161,27 @@ void SortedStream::nullRecords(thread_db* tdbb) const
 	m_next->nullRecords(tdbb);
 }
 
+void SortedStream::setRowLimit(jrd_req* request, FB_UINT64 rows) const
+{
+	// Duplicates must be seen to be eliminated, so projection cannot be limited
+
+	if (!(m_map->flags & FLAG_PROJECT))
+	{
+		Impure* const impure = request->getImpure<Impure>(m_impure);
+		impure->irsb_limit = rows;
+	}
+}
+
 Sort* SortedStream::init(thread_db* tdbb) const
 {
 	jrd_req* const request = tdbb->getRequest();
+	Impure* const impure = request->getImpure<Impure>(m_impure);
+
+	// Only the limited number of the first sorted records may be requested,
+	// then the sort keeps the least records only
+
+	const FB_UINT64 limit = impure->irsb_limit;
+	impure->irsb_limit = 0;
 
 	m_next->open(tdbb);
 	ULONG records = 0;
@@ -174,7 +193,7 @@ Sort* SortedStream::init(thread_db* tdbb) const
 		Sort(tdbb->getDatabase(), &request->req_sorts,
 			 m_map->length, m_map->keyItems.getCount(), m_map->keyItems.getCount(),
 			 m_map->keyItems.begin(),
-			 ((m_map->flags & FLAG_PROJECT) ? rejectDuplicate : nullptr), 0));
+			 ((m_map->flags & FLAG_PROJECT) ? rejectDuplicate : nullptr), 0, limit));
 
 	// Pump the input stream dry while pushing records into sort. For
 	// each record, map all fields into the sort record. The reverse
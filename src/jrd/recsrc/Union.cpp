@@ -59,7 +59,7 @@ Union::Union(CompilerScratch* csb, StreamType stream,
 		m_streams[i] = streams[i];
 }
 
-void Union::open(thread_db* tdbb) const
+void Union::internalOpen(thread_db* tdbb) const
 {
 	jrd_req* const request = tdbb->getRequest();
 	Impure* const impure = request->getImpure<Impure>(m_impure);
@@ -97,7 +97,7 @@ void Union::close(thread_db* tdbb) const
 	}
 }
 
-bool Union::getRecord(thread_db* tdbb) const
+bool Union::internalGetRecord(thread_db* tdbb) const
 {
 	JRD_reschedule(tdbb);
 
@@ -168,7 +168,8 @@ void Union::print(thread_db* tdbb, string& plan, bool detailed, unsigned level)
 {
 	if (detailed)
 	{
-		plan += printIndent(++level) + (m_args.getCount() == 1 ? "Materialize" : "Union");
+		plan += printIndent(++level) + (m_args.getCount() == 1 ? "Materialize" : "Union") +
+			printProfile(tdbb);
 
 		for (FB_SIZE_T i = 0; i < m_args.getCount(); i++)
 			m_args[i]->print(tdbb, plan, true, level);
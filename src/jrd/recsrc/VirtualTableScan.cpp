@@ -44,7 +44,7 @@ VirtualTableScan::VirtualTableScan(CompilerScratch* csb, const string& alias,
 	m_impure = csb->allocImpure<Impure>();
 }
 
-void VirtualTableScan::open(thread_db* tdbb) const
+void VirtualTableScan::internalOpen(thread_db* tdbb) const
 {
 	jrd_req* const request = tdbb->getRequest();
 	Impure* const impure = request->getImpure<Impure>(m_impure);
@@ -71,7 +71,7 @@ void VirtualTableScan::close(thread_db* tdbb) const
 		impure->irsb_flags &= ~irsb_open;
 }
 
-bool VirtualTableScan::getRecord(thread_db* tdbb) const
+bool VirtualTableScan::internalGetRecord(thread_db* tdbb) const
 {
 	JRD_reschedule(tdbb);
 
@@ -115,7 +115,8 @@ void VirtualTableScan::print(thread_db* tdbb, string& plan, bool detailed, unsig
 	if (detailed)
 	{
 		plan += printIndent(++level) + "Table " +
-			printName(tdbb, m_relation->rel_name.c_str(), m_alias) + " Full Scan";
+			printName(tdbb, m_relation->rel_name.c_str(), m_alias) + " Full Scan" +
+			printProfile(tdbb);
 	}
 	else
 	{
@@ -99,6 +99,8 @@ RELATION(nam_indices, rel_indices, ODS_8_0, rel_persistent)
 	FIELD(f_idx_exp_blr, nam_exp_blr, fld_value, 1, ODS_8_0)
 	FIELD(f_idx_exp_source, nam_exp_source, fld_source, 1, ODS_8_0)
 	FIELD(f_idx_statistics, nam_statistics, fld_statistics, 1, ODS_8_0)
+	FIELD(f_idx_cond_blr, nam_cond_blr, fld_value, 1, ODS_13_1)
+	FIELD(f_idx_cond_source, nam_cond_source, fld_source, 1, ODS_13_1)
 END_RELATION
 
 // Relation 5 (RDB$RELATION_FIELDS)
@@ -585,6 +587,10 @@ RELATION(nam_mon_io_stats, rel_mon_io_stats, ODS_11_1, rel_virtual)
 	FIELD(f_mon_io_page_writes, nam_mon_page_writes, fld_counter, 0, ODS_11_1)
 	FIELD(f_mon_io_page_fetches, nam_mon_page_fetches, fld_counter, 0, ODS_11_1)
 	FIELD(f_mon_io_page_marks, nam_mon_page_marks, fld_counter, 0, ODS_11_1)
+	FIELD(f_mon_io_page_read_time, nam_mon_page_read_time, fld_counter, 0, ODS_13_1)
+	FIELD(f_mon_io_page_write_time, nam_mon_page_write_time, fld_counter, 0, ODS_13_1)
+	FIELD(f_mon_io_latch_wait_time, nam_mon_latch_wait_time, fld_counter, 0, ODS_13_1)
+	FIELD(f_mon_io_lock_wait_time, nam_mon_lock_wait_time, fld_counter, 0, ODS_13_1)
 END_RELATION
 
 // Relation 39 (MON$RECORD_STATS)
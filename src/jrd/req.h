@@ -180,6 +180,7 @@ public:
 		  req_cursors(*req_pool),
 		  req_ext_resultset(NULL),
 		  req_timeout(0),
+		  req_profile_run(0),
 		  req_domain_validation(NULL),
 		  req_sorts(*req_pool),
 		  req_rpb(*req_pool),
@@ -281,6 +282,7 @@ public:
 
 	ULONG req_src_line;
 	ULONG req_src_column;
+	ULONG req_profile_run;		// number of the last profiled run, see RecordSource::getRecord()
 
 	dsc*			req_domain_validation;	// Current VALUE for constraint validation
 	SortOwner req_sorts;
@@ -402,6 +404,7 @@ const ULONG req_same_tx_upd		= 0x400L;		// record was updated by same transactio
 const ULONG req_reserved		= 0x800L;		// Request reserved for client
 const ULONG req_update_conflict	= 0x1000L;		// We need to restart request due to update conflict
 const ULONG req_restart_ready	= 0x2000L;		// Request is ready to restat in case of update conflict
+const ULONG req_profile			= 0x4000L;		// Collect record source execution statistics
 
 
 // Index lock block
@@ -86,6 +86,9 @@ void SortOwner::unlinkAll()
 const ULONG MAX_SORT_BUFFER_SIZE = 1024 * 128;	// 128KB
 const ULONG MIN_RECORDS_TO_ALLOC = 8;
 
+// Max size of the buffer to keep the limited number of the least records in
+const ULONG MAX_TOP_BUFFER_SIZE = 1024 * 1024 * 8;	// 8MB
+
 // the size of sr_bckptr (everything before sort_record) in bytes
 #define SIZEOF_SR_BCKPTR offsetof(sr, sr_sort_record)
 // the size of sr_bckptr in # of 32 bit longwords
@@ -154,6 +157,17 @@ namespace
 		*a = *b;
 		*b = temp;
 	}
+
+	inline int compareKeys(const SORTP* p, const SORTP* q, ULONG length)
+	{
+		for (; length; length--, p++, q++)
+		{
+			if (*p != *q)
+				return (*p > *q) ? 1 : -1;
+		}
+
+		return 0;
+	}
 } // namespace
 
 
@@ -228,6 +242,41 @@ Sort::Sort(Database* dbb,
 
 		allocateBuffer(pool);
 
+		// If only the first records are going to be fetched and all of them fit
+		// in memory, keep the least ones only while records are being put.
+		// Nothing is written to the scratch file then.
+
+		if (m_max_records && !m_dup_callback && m_max_records < MAX_TOP_BUFFER_SIZE / record_size)
+		{
+			// Room for one more record and pointers including low and high keys
+			const ULONG top_size = (ULONG) (m_max_records + 1) * record_size +
+				(ULONG) (m_max_records + 4) * sizeof(sort_record*);
+
+			if (top_size <= MAX_TOP_BUFFER_SIZE)
+			{
+				if (top_size > m_size_memory)
+				{
+					// Allocate from the permanent pool, as the block may be
+					// cached by releaseBuffer() if its size happens to match
+
+					try
+					{
+						UCHAR* const mem = FB_NEW_POOL(*m_dbb->dbb_permanent) UCHAR[top_size];
+
+						releaseBuffer();
+
+						m_size_memory = top_size;
+						m_memory = mem;
+					}
+					catch (const BadAlloc&)
+					{} // no-op
+				}
+
+				if (top_size <= m_size_memory)
+					m_flags |= scb_top;
+			}
+		}
+
 		m_end_memory = m_memory + m_size_memory;
 		m_first_pointer = (sort_record**) m_memory;
 
@@ -380,6 +429,12 @@ void Sort::put(thread_db* tdbb, ULONG** record_address)
 		if (record != (SR*) m_end_memory)
 		{
 			diddleKey((UCHAR*) (record->sr_sort_record.sort_record_key), true, false);
+
+			if ((m_flags & scb_top) && m_records > m_max_records)
+			{
+				limitRecords();
+				record = m_last_record;
+			}
 		}
 
 		// If there isn't room for the record, sort and write the run.
@@ -389,6 +444,8 @@ void Sort::put(thread_db* tdbb, ULONG** record_address)
 		if ((UCHAR*) record < m_memory + m_longs ||
 			(UCHAR*) NEXT_RECORD(record) <= (UCHAR*) (m_next_pointer + 1))
 		{
+			fb_assert(!(m_flags & scb_top));
+
 			putRun(tdbb);
 			while (true)
 			{
@@ -451,6 +508,9 @@ void Sort::sort(thread_db* tdbb)
 		if (m_last_record != (SR*) m_end_memory)
 		{
 			diddleKey((UCHAR*) KEYOF(m_last_record), true, false);
+
+			if ((m_flags & scb_top) && m_records > m_max_records)
+				limitRecords();
 		}
 
 		// If there aren't any runs, things fit nicely in memory. Just sort the mess
@@ -1422,6 +1482,68 @@ void Sort::init()
 }
 
 
+void Sort::limitRecords()
+{
+/**************************************
+ *
+ * The last record put is one more than requested. Pointers to the
+ * previous records form a max-heap rooted right after the low key.
+ * Copy the last record over the greatest one if it's less, otherwise
+ * discard it. Either way, its space is reused by the next record.
+ *
+ **************************************/
+	fb_assert(m_flags & scb_top);
+	fb_assert(m_records == m_max_records + 1);
+
+	SORTP** const heap = (SORTP**) m_first_pointer;
+	const ULONG count = (ULONG) m_max_records;
+
+	if (!(m_flags & scb_heap))
+	{
+		for (ULONG i = count / 2; i; i--)
+			siftDown(i);
+
+		m_flags |= scb_heap;
+	}
+
+	const SORTP* const record = heap[count + 1];
+
+	if (compareKeys(record, heap[1], m_key_length) < 0)
+	{
+		memcpy(heap[1], record, (m_longs - SIZEOF_SR_BCKPTR_IN_LONGS) << SHIFTLONG);
+		siftDown(1);
+	}
+
+	m_next_pointer--;
+	m_records--;
+	m_last_record = (SR*) ((SORTP*) m_last_record + m_longs);
+}
+
+
+void Sort::siftDown(ULONG index)
+{
+/**************************************
+ *
+ * Restore the max-heap property of the record pointers
+ * starting from the given (one-based) heap slot.
+ *
+ **************************************/
+	SORTP** const heap = (SORTP**) m_first_pointer;
+	const ULONG count = (ULONG) m_max_records;
+
+	for (ULONG child; (child = index * 2) <= count; index = child)
+	{
+		if (child < count && compareKeys(heap[child + 1], heap[child], m_key_length) > 0)
+			child++;
+
+		if (compareKeys(heap[child], heap[index], m_key_length) <= 0)
+			break;
+
+		swap(heap + index, heap + child);
+	}
+}
+
+
 #ifdef DEV_BUILD
 void Sort::checkFile(const run_control* temp_run)
 {
@@ -298,6 +298,8 @@ private:
 	void putRun(Jrd::thread_db*);
 	void sortBuffer(Jrd::thread_db*);
 	void sortRunsBySeek(int);
+	void limitRecords();
+	void siftDown(ULONG);
 
 #ifdef DEV_BUILD
 	void checkFile(const run_control*);
@@ -317,7 +319,7 @@ private:
 	ULONG m_key_length;							// Key length
 	ULONG m_unique_length;						// Unique key length, used when duplicates eliminated
 	FB_UINT64 m_records;						// Number of records
-	FB_UINT64 m_max_records;					// Maximum number of records to store, assigned but unused.
+	FB_UINT64 m_max_records;					// Maximum number of records to return, zero if unlimited
 	TempSpace* m_space;							// temporary space for scratch file
 	run_control* m_runs;						// ALLOC: Run on scratch file, if any
 	merge_control* m_merge;						// Top level merge block
@@ -336,6 +338,8 @@ private:
 // flags as set in m_flags
 
 const int scb_sorted = 1;	// stream has been sorted
+const int scb_top = 2;		// only m_max_records least records are kept in memory
+const int scb_heap = 4;		// pointers to the records kept form a max-heap
 
 class SortOwner
 {
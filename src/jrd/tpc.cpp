@@ -37,6 +37,21 @@
 
 using namespace Firebird;
 
+namespace
+{
+	// Raise the shared counter, never lower it
+	inline void storeMax(std::atomic<TraNumber>& value, TraNumber number)
+	{
+		TraNumber current = value.load(std::memory_order_relaxed);
+
+		while (current < number &&
+			!value.compare_exchange_weak(current, number, std::memory_order_release,
+				std::memory_order_relaxed))
+		{
+		}
+	}
+}
+
 namespace Jrd {
 
 void TipCache::MemoryInitializer::mutexBug(int osErrorCode, const char* text)
@@ -271,6 +286,7 @@ void TipCache::loadInventoryPages(thread_db* tdbb, GlobalTpcHeader* header)
 	WIN window(HEADER_PAGE_NUMBER);
 	const Ods::header_page* header_page = (Ods::header_page*) CCH_FETCH(tdbb, &window, LCK_read, pag_header);
 	const TraNumber hdr_oldest_transaction = Ods::getOIT(header_page);
+	const TraNumber hdr_oldest_active = Ods::getOAT(header_page);
 	const TraNumber hdr_next_transaction = Ods::getNT(header_page);
 	const AttNumber hdr_attachment_id = Ods::getAttID(header_page);
 	CCH_RELEASE(tdbb, &window);
@@ -279,6 +295,9 @@ void TipCache::loadInventoryPages(thread_db* tdbb, GlobalTpcHeader* header)
 	header->oldest_transaction.store(hdr_oldest_transaction, std::memory_order_relaxed);
 	header->latest_attachment_id.store(hdr_attachment_id, std::memory_order_relaxed);
 	header->latest_transaction_id.store(hdr_next_transaction, std::memory_order_relaxed);
+	header->reserved_transaction_id = hdr_next_transaction;
+	header->oldest_interesting.store(hdr_oldest_transaction, std::memory_order_relaxed);
+	header->oldest_active.store(hdr_oldest_active, std::memory_order_relaxed);
 
 	// Check if TIP has any interesting transactions.
 	// At database creation time, it doesn't and the code below breaks
@@ -1039,6 +1058,79 @@ TraNumber TipCache::generateTransactionId()
 	return transaction_id;
 }
 
+void TipCache::lockTransactionIds()
+{
+	// Can only be called on initialized TipCache
+	fb_assert(m_tpcHeader);
+	m_tpcHeader->mutexLock();
+}
+
+void TipCache::unlockTransactionIds()
+{
+	fb_assert(m_tpcHeader);
+	m_tpcHeader->mutexUnlock();
+}
+
+TraNumber TipCache::allocateTransactionId()
+{
+	// Can only be called on initialized TipCache
+	fb_assert(m_tpcHeader);
+	GlobalTpcHeader* header = m_tpcHeader->getHeader();
+
+	const TraNumber latest = header->latest_transaction_id.load(std::memory_order_relaxed);
+
+	if (latest >= header->reserved_transaction_id)
+		return 0;
+
+	header->latest_transaction_id.store(latest + 1, std::memory_order_release);
+	return latest + 1;
+}
+
+void TipCache::setReservedTransactionId(TraNumber number)
+{
+	// Can only be called on initialized TipCache
+	fb_assert(m_tpcHeader);
+	m_tpcHeader->getHeader()->reserved_transaction_id = number;
+}
+
+TraNumber TipCache::getReservedTransactionId() const
+{
+	// Can only be called on initialized TipCache
+	fb_assert(m_tpcHeader);
+	return m_tpcHeader->getHeader()->reserved_transaction_id;
+}
+
+TraNumber TipCache::getLatestTransactionId() const
+{
+	// Can only be called on initialized TipCache
+	fb_assert(m_tpcHeader);
+	return m_tpcHeader->getHeader()->latest_transaction_id.load(std::memory_order_acquire);
+}
+
+void TipCache::publishOldestTransactions(TraNumber oldest, TraNumber oldestActive)
+{
+	// Can only be called on initialized TipCache
+	fb_assert(m_tpcHeader);
+	GlobalTpcHeader* header = m_tpcHeader->getHeader();
+
+	storeMax(header->oldest_interesting, oldest);
+	storeMax(header->oldest_active, oldestActive);
+}
+
+TraNumber TipCache::getOldestInteresting() const
+{
+	// Can only be called on initialized TipCache
+	fb_assert(m_tpcHeader);
+	return m_tpcHeader->getHeader()->oldest_interesting.load(std::memory_order_acquire);
+}
+
+TraNumber TipCache::getOldestActive() const
+{
+	// Can only be called on initialized TipCache
+	fb_assert(m_tpcHeader);
+	return m_tpcHeader->getHeader()->oldest_active.load(std::memory_order_acquire);
+}
+
 AttNumber TipCache::generateAttachmentId()
 {
 	// Can only be called on initialized TipCache
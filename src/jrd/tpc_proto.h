@@ -135,6 +135,28 @@ public:
 
 	// Transactions, attachments, statements ID management.
 	TraNumber generateTransactionId();
+
+	// In read-write databases, transaction numbers are allocated from the range
+	// reserved on the header page. The TPC mutex is held by the caller since the
+	// number is allocated till the transaction lock is taken, so that all numbers
+	// below the latest one belong to transactions either started or finished.
+	// The mutex is never held while doing I/O or waiting for a lock.
+	void lockTransactionIds();
+	void unlockTransactionIds();
+
+	// Return the next transaction number or zero if the reserved range is exhausted
+	TraNumber allocateTransactionId();
+	void setReservedTransactionId(TraNumber number);
+	TraNumber getReservedTransactionId() const;
+	TraNumber getLatestTransactionId() const;
+
+	// Oldest interesting and oldest active transactions known to all processes.
+	// They are published when a transaction start or sweep computes newer values,
+	// so Classic processes don't need to read them from the header page.
+	void publishOldestTransactions(TraNumber oldest, TraNumber oldestActive);
+	TraNumber getOldestInteresting() const;
+	TraNumber getOldestActive() const;
+
 	AttNumber generateAttachmentId();
 	StmtNumber generateStatementId();
 	//void assignLatestTransactionId(TraNumber number);
@@ -169,6 +191,13 @@ private:
 		std::atomic<AttNumber> latest_attachment_id;
 		std::atomic<StmtNumber> latest_statement_id;
 
+		// Next transaction number stored on the header page, protected by the mutex
+		TraNumber reserved_transaction_id;
+
+		// OIT and OAT as seen by all processes, never decrease
+		std::atomic<TraNumber> oldest_interesting;
+		std::atomic<TraNumber> oldest_active;
+
 		// Size of memory chunk with TransactionStatusBlock
 		ULONG tpc_block_size; // final
 	};
@@ -253,7 +282,7 @@ private:
 
 	typedef Firebird::BePlusTree<StatusBlockData*, TpcBlockNumber, Firebird::MemoryPool, StatusBlockData> BlocksMemoryMap;
 
-	static const ULONG TPC_VERSION = 1;
+	static const ULONG TPC_VERSION = 3;
 	static const int SAFETY_GAP_BLOCKS = 1;
 
 	Firebird::SharedMemory<GlobalTpcHeader>* m_tpcHeader; // final
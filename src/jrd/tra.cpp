@@ -88,10 +88,57 @@ using namespace Firebird;
 typedef Firebird::GenericMap<Firebird::Pair<Firebird::NonPooled<USHORT, UCHAR> > > RelationLockTypeMap;
 
 
+namespace
+{
+	// Holds allocation of transaction numbers locked
+
+	class TransactionIdGuard
+	{
+	public:
+		explicit TransactionIdGuard(TipCache* cache)
+			: m_cache(NULL)
+		{
+			lock(cache);
+		}
+
+		TransactionIdGuard()
+			: m_cache(NULL)
+		{}
+
+		~TransactionIdGuard()
+		{
+			release();
+		}
+
+		void lock(TipCache* cache)
+		{
+			fb_assert(!m_cache);
+			cache->lockTransactionIds();
+			m_cache = cache;
+		}
+
+		void release()
+		{
+			if (m_cache)
+			{
+				m_cache->unlockTransactionIds();
+				m_cache = NULL;
+			}
+		}
+
+	private:
+		TransactionIdGuard(const TransactionIdGuard&);
+		TransactionIdGuard& operator=(const TransactionIdGuard&);
+
+		TipCache* m_cache;
+	};
+} // namespace
+
+
 #ifdef SUPERSERVER_V2
 static TraNumber bump_transaction_id(thread_db*, WIN*);
 #else
-static header_page* bump_transaction_id(thread_db*, WIN*, bool);
+static TraNumber bump_transaction_id(thread_db*, TransactionIdGuard&);
 #endif
 static void retain_context(thread_db* tdbb, jrd_tra* transaction, bool commit, int state);
 static void expand_view_lock(thread_db* tdbb, jrd_tra*, jrd_rel*, UCHAR lock_type,
@@ -1190,6 +1237,71 @@ jrd_tra* TRA_reconnect(thread_db* tdbb, const UCHAR* id, USHORT length)
 }
 
 
+void TRA_release_reserved_ids(thread_db* tdbb, Database* dbb)
+{
+/**************************************
+ *
+ *	T R A _ r e l e a s e _ r e s e r v e d _ i d s
+ *
+ **************************************
+ *
+ * Functional description
+ *	Stop allocation of transaction ids reserved on the header
+ *	page but not used yet and mark them committed in the TIP,
+ *	otherwise they would be seen as active or dead transactions
+ *	holding the OIT. Next range is reserved beyond them.
+ *
+ **************************************/
+	SET_TDBB(tdbb);
+
+	if (!dbb || !dbb->dbb_tip_cache || (dbb->dbb_flags & (DBB_read_only | DBB_new)))
+		return;
+
+#ifndef SUPERSERVER_V2
+	TipCache* const cache = dbb->dbb_tip_cache;
+
+	// The mutex is held for a moment only
+
+	TransactionIdGuard idGuard(cache);
+
+	const TraNumber reserved = cache->getReservedTransactionId();
+	const TraNumber latest = cache->getLatestTransactionId();
+
+	if (latest < reserved)
+		cache->setReservedTransactionId(latest);
+
+	idGuard.release();
+
+	// Nobody could allocate these ids anymore, the header page keeps them
+	// reserved. Mark them committed page by page.
+
+	const ULONG trans_per_tip = dbb->dbb_page_manager.transPerTIP;
+
+	for (TraNumber number = latest + 1; number <= reserved;)
+	{
+		WIN window(DB_PAGE_SPACE, -1);
+		tx_inv_page* tip = fetch_inventory_page(tdbb, &window, (ULONG) (number / trans_per_tip), LCK_write);
+		CCH_MARK_MUST_WRITE(tdbb, &window);
+
+		const TraNumber end = MIN(reserved, (number / trans_per_tip + 1) * trans_per_tip - 1);
+
+		for (; number <= end; number++)
+		{
+			UCHAR* address = tip->tip_transactions + TRANS_OFFSET(number % trans_per_tip);
+			const USHORT shift = TRANS_SHIFT(number);
+
+			*address &= ~(TRA_MASK << shift);
+			*address |= tra_committed << shift;
+
+			TPC_set_state(tdbb, number, tra_committed);
+		}
+
+		CCH_RELEASE(tdbb, &window);
+	}
+#endif
+}
+
+
 void TRA_release_transaction(thread_db* tdbb, jrd_tra* transaction, Jrd::TraceTransactionEnd* trace)
 {
 /**************************************
@@ -1893,6 +2005,7 @@ void TRA_sweep(thread_db* tdbb)
 			{
 				CCH_MARK_MUST_WRITE(tdbb, &window);
 				Ods::writeOIT(header, MIN(active, transaction_oldest_active));
+				dbb->dbb_tip_cache->publishOldestTransactions(Ods::getOIT(header), 0);
 			}
 
 			traceSweep.update(header);
@@ -2051,7 +2164,7 @@ static TraNumber bump_transaction_id(thread_db* tdbb, WIN* window)
 #else
 
 
-static header_page* bump_transaction_id(thread_db* tdbb, WIN* window, bool dontWrite)
+static TraNumber bump_transaction_id(thread_db* tdbb, TransactionIdGuard& idGuard)
 {
 /**************************************
  *
@@ -2060,72 +2173,125 @@ static header_page* bump_transaction_id(thread_db* tdbb, WIN* window, bool dontW
  **************************************
  *
  * Functional description
- *	Fetch header and bump next transaction id.  If necessary,
- *	extend TIP.
+ *	Allocate next transaction id from the range reserved
+ *	on the header page. Return with allocation of ids locked,
+ *	so the caller takes the transaction lock before any other
+ *	id is allocated. If the range is exhausted, reserve the
+ *	next one extending TIP as necessary, it's done with
+ *	allocation of ids unlocked.
  *
  **************************************/
 	SET_TDBB(tdbb);
 	Database* dbb = tdbb->getDatabase();
 	CHECK_DBB(dbb);
 
-	window->win_page = HEADER_PAGE_NUMBER;
-	header_page* header = (header_page*) CCH_FETCH(tdbb, window, LCK_write, pag_header);
+	TipCache* const cache = dbb->dbb_tip_cache;
 
-	const TraNumber next_transaction = Ods::getNT(header);
-	const TraNumber oldest_active = Ods::getOAT(header);
-	const TraNumber oldest_transaction = Ods::getOIT(header);
-	const TraNumber oldest_snapshot = Ods::getOST(header);
-
-	// Before incrementing the next transaction Id, make sure the current one is valid
-	if (next_transaction)
+	while (true)
 	{
-		if (oldest_active > next_transaction)
-			BUGCHECK(266);		//next transaction older than oldest active
+		idGuard.lock(cache);
 
-		if (oldest_transaction > next_transaction)
-			BUGCHECK(267);		// next transaction older than oldest transaction
-	}
+		const TraNumber number = cache->allocateTransactionId();
 
-	if (next_transaction >= MAX_TRA_NUMBER - 1)
-	{
-		CCH_RELEASE(tdbb, window);
-		ERR_post(Arg::Gds(isc_imp_exc) <<
-				 Arg::Gds(isc_tra_num_exc));
-	}
+		if (number)
+		{
+			//dbb->assignLatestTransactionId(number);
+			dbb->dbb_next_transaction = number;
+
+			return number;
+		}
 
-	const TraNumber number = next_transaction + 1;
+		idGuard.release();
 
-	// If this is the first transaction on a TIP, allocate the TIP now.
-	// Note, first TIP page is created with the database itself,
-	// see JProvider::createDatabase.
+		WIN window(HEADER_PAGE_NUMBER);
+		header_page* header = (header_page*) CCH_FETCH(tdbb, &window, LCK_write, pag_header);
 
-	const bool new_tip = ((number % dbb->dbb_page_manager.transPerTIP) == 0);
+		// Another thread or process could reserve more ids while we were waiting
 
-	if (new_tip)
-		TRA_extend_tip(tdbb, (number / dbb->dbb_page_manager.transPerTIP)); //, window);
+		idGuard.lock(cache);
+		const bool exhausted = (cache->getLatestTransactionId() >= cache->getReservedTransactionId());
+		idGuard.release();
+
+		if (!exhausted)
+		{
+			CCH_RELEASE(tdbb, &window);
+			continue;
+		}
 
-	// Extend, if necessary, has apparently succeeded.  Next, update header page
+		const TraNumber next_transaction = Ods::getNT(header);
+		const TraNumber oldest_active = Ods::getOAT(header);
+		const TraNumber oldest_transaction = Ods::getOIT(header);
+		const TraNumber oldest_snapshot = Ods::getOST(header);
 
-	if (dontWrite && !new_tip)
-		CCH_MARK(tdbb, window);
-	else
-		CCH_MARK_MUST_WRITE(tdbb, window);
+		// Before reserving more transaction ids, make sure the current one is valid
+		if (next_transaction)
+		{
+			if (oldest_active > next_transaction)
+				BUGCHECK(266);		//next transaction older than oldest active
+
+			if (oldest_transaction > next_transaction)
+				BUGCHECK(267);		// next transaction older than oldest transaction
+		}
+
+		// Ids may be generated beyond the header page while the database is read-only
+		const TraNumber first = MAX(next_transaction, cache->getLatestTransactionId()) + 1;
+
+		if (first >= MAX_TRA_NUMBER)
+		{
+			CCH_RELEASE(tdbb, &window);
+			ERR_post(Arg::Gds(isc_imp_exc) <<
+					 Arg::Gds(isc_tra_num_exc));
+		}
+
+		const TraNumber last = MIN(first + TRA_RESERVED_IDS - 1, MAX_TRA_NUMBER - 1);
+
+		// If there are first transactions on TIP pages in the range, allocate them now.
+		// Note, first TIP page is created with the database itself,
+		// see JProvider::createDatabase.
+
+		const ULONG trans_per_tip = dbb->dbb_page_manager.transPerTIP;
+
+		for (TraNumber tip_first = (first + trans_per_tip - 1) / trans_per_tip * trans_per_tip;
+			 tip_first <= last; tip_first += trans_per_tip)
+		{
+			TRA_extend_tip(tdbb, (ULONG) (tip_first / trans_per_tip));
+		}
+
+		// Extend, if necessary, has apparently succeeded. Next, update header page.
+		// It's written when released, before any of reserved ids is used.
+
+		CCH_MARK_MUST_WRITE(tdbb, &window);
 
-	//dbb->assignLatestTransactionId(number);
-	dbb->dbb_next_transaction = number;
+		Ods::writeNT(header, last);
 
-	Ods::writeNT(header, number);
+		// Store the oldest transactions known to this process,
+		// pick up the values stored by other processes if they are newer.
 
-	if (dbb->dbb_oldest_active > oldest_active)
-		Ods::writeOAT(header, dbb->dbb_oldest_active);
+		if (dbb->dbb_oldest_active > oldest_active)
+			Ods::writeOAT(header, dbb->dbb_oldest_active);
+		else
+			dbb->dbb_oldest_active = oldest_active;
+
+		if (dbb->dbb_oldest_transaction > oldest_transaction)
+			Ods::writeOIT(header, dbb->dbb_oldest_transaction);
+		else
+			dbb->dbb_oldest_transaction = oldest_transaction;
+
+		if (dbb->dbb_oldest_snapshot > oldest_snapshot)
+			Ods::writeOST(header, dbb->dbb_oldest_snapshot);
+
+		CCH_RELEASE(tdbb, &window);
 
-	if (dbb->dbb_oldest_transaction > oldest_transaction)
-		Ods::writeOIT(header, dbb->dbb_oldest_transaction);
+		// Let the reserved ids be allocated, unless even more ids
+		// were reserved by another process meanwhile
 
-	if (dbb->dbb_oldest_snapshot > oldest_snapshot)
-		Ods::writeOST(header, dbb->dbb_oldest_snapshot);
+		idGuard.lock(cache);
 
-	return header;
+		if (cache->getReservedTransactionId() < last)
+			cache->setReservedTransactionId(last);
+
+		idGuard.release();
+	}
 }
 #endif
 
@@ -2570,21 +2736,22 @@ static void retain_context(thread_db* tdbb, jrd_tra* transaction, bool commit, i
 
 	// Create a new transaction lock, inheriting oldest active from transaction being committed.
 
-	WIN window(DB_PAGE_SPACE, -1);
 	TraNumber new_number;
 #ifdef SUPERSERVER_V2
+	WIN window(DB_PAGE_SPACE, -1);
 	new_number = bump_transaction_id(tdbb, &window);
+	const SSHORT lockWait = LCK_WAIT;
 #else
+	TransactionIdGuard idGuard;
+
 	if (dbb->readOnly())
 		new_number = dbb->generateTransactionId();
 	else
-	{
-		const bool dontWrite = (dbb->dbb_flags & DBB_shared) &&
-			(transaction->tra_flags & TRA_readonly);
+		new_number = bump_transaction_id(tdbb, idGuard);
 
-		const header_page* const header = bump_transaction_id(tdbb, &window, dontWrite);
-		new_number = Ods::getNT(header);
-	}
+	// Nobody else can own the lock of just allocated number,
+	// so don't wait for it while other ids can't be allocated
+	const SSHORT lockWait = dbb->readOnly() ? LCK_WAIT : LCK_NO_WAIT;
 #endif
 
 	Lock* new_lock = NULL;
@@ -2595,19 +2762,17 @@ static void retain_context(thread_db* tdbb, jrd_tra* transaction, bool commit, i
 		new_lock->setKey(new_number);
 		new_lock->lck_data = transaction->tra_lock->lck_data;
 
-		if (!LCK_lock(tdbb, new_lock, LCK_write, LCK_WAIT))
+		if (!LCK_lock(tdbb, new_lock, LCK_write, lockWait))
 		{
 #ifndef SUPERSERVER_V2
-			if (!dbb->readOnly())
-				CCH_RELEASE(tdbb, &window);
+			idGuard.release();
 #endif
 			ERR_post(Arg::Gds(isc_lock_conflict));
 		}
 	}
 
 #ifndef SUPERSERVER_V2
-	if (!dbb->readOnly())
-		CCH_RELEASE(tdbb, &window);
+	idGuard.release();
 #endif
 
 	// Update database notion of the youngest commit retaining
@@ -3446,7 +3611,6 @@ static void transaction_start(thread_db* tdbb, jrd_tra* trans)
 	SET_TDBB(tdbb);
 	Database* const dbb = tdbb->getDatabase();
 	Jrd::Attachment* const attachment = tdbb->getAttachment();
-	WIN window(DB_PAGE_SPACE, -1);
 
 	Lock* lock = FB_NEW_RPT(*tdbb->getDefaultPool(), 0) Lock(tdbb, sizeof(TraNumber), LCK_tra);
 
@@ -3457,33 +3621,46 @@ static void transaction_start(thread_db* tdbb, jrd_tra* trans)
 	TraNumber oldest, number, active, oldest_active;
 
 #ifdef SUPERSERVER_V2
+	WIN window(DB_PAGE_SPACE, -1);
 	number = bump_transaction_id(tdbb, &window);
 	oldest = dbb->dbb_oldest_transaction;
 	active = MAX(dbb->dbb_oldest_active, dbb->dbb_oldest_transaction);
 	oldest_active = dbb->dbb_oldest_active;
+	const SSHORT lockWait = LCK_WAIT;
 
 #else // SUPERSERVER_V2
+	TransactionIdGuard idGuard;
+
 	if (dbb->readOnly())
-	{
 		number = dbb->generateTransactionId();
-		oldest = dbb->dbb_oldest_transaction;
-		oldest_active = dbb->dbb_oldest_active;
-	}
 	else
 	{
-		const bool dontWrite = (dbb->dbb_flags & DBB_shared) &&
-			(trans->tra_flags & TRA_readonly);
+		// In Classic, the database block is not shared by processes.
+		// Pick up the oldest transactions published by the other ones.
 
-		const header_page* header = bump_transaction_id(tdbb, &window, dontWrite);
-		number = Ods::getNT(header);
-		oldest = Ods::getOIT(header);
-		oldest_active = Ods::getOAT(header);
+		if (!(dbb->dbb_flags & DBB_shared))
+		{
+			TipCache* const tipCache = dbb->dbb_tip_cache;
+
+			dbb->dbb_oldest_transaction =
+				MAX(dbb->dbb_oldest_transaction, tipCache->getOldestInteresting());
+			dbb->dbb_oldest_active = MAX(dbb->dbb_oldest_active, tipCache->getOldestActive());
+		}
+
+		number = bump_transaction_id(tdbb, idGuard);
 	}
 
+	oldest = dbb->dbb_oldest_transaction;
+	oldest_active = dbb->dbb_oldest_active;
+
 	// oldest (OIT) > oldest_active (OAT) if OIT was advanced by sweep
 	// and no transactions was started after the sweep starts
 	active = MAX(oldest_active, oldest);
 
+	// Nobody else can own the lock of just allocated number,
+	// so don't wait for it while other ids can't be allocated
+	const SSHORT lockWait = dbb->readOnly() ? LCK_WAIT : LCK_NO_WAIT;
+
 #endif // SUPERSERVER_V2
 
 	// Allocate pool and transactions block.  Since, by policy,
@@ -3512,25 +3689,23 @@ static void transaction_start(thread_db* tdbb, jrd_tra* trans)
 		!(trans->tra_flags & TRA_read_consistency)) ? number : active;
 	lock->lck_object = trans;
 
-	if (!LCK_lock(tdbb, lock, LCK_write, LCK_WAIT))
+	if (!LCK_lock(tdbb, lock, LCK_write, lockWait))
 	{
 #ifndef SUPERSERVER_V2
-		if (!dbb->readOnly())
-			CCH_RELEASE(tdbb, &window);
+		idGuard.release();
 #endif
 		ERR_post(Arg::Gds(isc_lock_conflict));
 	}
 
-	// Link the transaction to the attachment block before releasing
-	// header page for handling signals.
+	// Link the transaction to the attachment block before allowing
+	// other transactions to start for handling signals.
 
 	trans->linkToAttachment(attachment);
 
 	try
 	{
 #ifndef SUPERSERVER_V2
-		if (!dbb->readOnly())
-			CCH_RELEASE(tdbb, &window);
+		idGuard.release();
 #endif
 
 		if (dbb->readOnly())
@@ -3686,7 +3861,10 @@ static void transaction_start(thread_db* tdbb, jrd_tra* trans)
 			}
 		}
 
-		// Release TPC shared memory if counters moved sufficently forward
+		// Let other processes know the new oldest transactions and release
+		// TPC shared memory if counters moved sufficently forward
+		dbb->dbb_tip_cache->publishOldestTransactions(dbb->dbb_oldest_transaction,
+			dbb->dbb_oldest_active);
 		dbb->dbb_tip_cache->updateOldestTransaction(tdbb,
 			dbb->dbb_oldest_transaction, dbb->dbb_oldest_snapshot);
 
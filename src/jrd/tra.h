@@ -445,6 +445,11 @@ const int TRA_SHIFT				= 2;
 
 const int TRA_ACTIVE_CLEANUP	= 100;
 
+// Number of transaction ids reserved at once on the header page.
+// Ids reserved but not used before a crash are seen as dead transactions.
+
+const int TRA_RESERVED_IDS	= 128;
+
 // Transaction states.  The first four are states found
 // in the transaction inventory page; the last two are
 // returned internally
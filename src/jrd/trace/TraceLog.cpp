@@ -143,16 +143,35 @@ FB_SIZE_T TraceLog::write(const void* buf, FB_SIZE_T size)
 
 	fb_assert(!m_reader);
 
-	TraceLogGuard guard(this);
-
 	TraceLogHeader* header = m_sharedMemory->getHeader();
 
+	// Don't wait for the mutex if nothing could be written anyway.
+	// Flags are re-checked below under the mutex.
+
+	const ULONG flags = header->flags;
+
 	// if reader already gone, don't write anything
+	if (flags & FLAG_DONE)
+		return size;
+
+	if (flags & FLAG_FULL)
+	{
+		header->dropped++;
+		return 0;
+	}
+
+	TraceLogGuard guard(this);
+
+	header = m_sharedMemory->getHeader();
+
 	if (header->flags & FLAG_DONE)
 		return size;
 
 	if (header->flags & FLAG_FULL)
+	{
+		header->dropped++;
 		return 0;
+	}
 
 	const FB_SIZE_T msgLen = m_fullMsg.length();
 
@@ -165,6 +184,7 @@ FB_SIZE_T TraceLog::write(const void* buf, FB_SIZE_T size)
 	if (size + msgLen > getFree(true))	// log is full
 	{
 		header->flags |= FLAG_FULL;
+		header->dropped++;
 
 		if (!msgLen)
 			return 0;
@@ -279,6 +299,12 @@ void TraceLog::setFullMsg(const char* str)
 	m_fullMsg = str;
 }
 
+ULONG TraceLog::resetDropped()
+{
+	TraceLogHeader* header = m_sharedMemory->getHeader();
+	return header->dropped.exchange(0);
+}
+
 void TraceLog::mutexBug(int state, const char* string)
 {
 	TEXT msg[BUFFER_TINY];
@@ -299,6 +325,7 @@ bool TraceLog::initialize(SharedMemoryBase* sm, bool initialize)
 		hdr->maxSize = Config::getMaxUserTraceLogSize() * 1024 * 1024;
 		hdr->allocated = sm->sh_mem_length_mapped;
 		hdr->flags = 0;
+		hdr->dropped = 0;
 	}
 	else
 	{
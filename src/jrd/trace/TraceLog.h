@@ -28,6 +28,7 @@
 #ifndef TRACE_LOG
 #define TRACE_LOG
 
+#include <atomic>
 #include "../../common/classes/fb_string.h"
 #include "../../common/isc_s_proto.h"
 
@@ -35,13 +36,14 @@ namespace Jrd {
 
 struct TraceLogHeader : public Firebird::MemoryHeader
 {
-	static const USHORT TRACE_LOG_VERSION = 2;
+	static const USHORT TRACE_LOG_VERSION = 3;
 
 	ULONG readPos;
 	ULONG writePos;
 	ULONG maxSize;
 	ULONG allocated;		// zero when reader gone
-	ULONG flags;
+	std::atomic<ULONG> flags;
+	std::atomic<ULONG> dropped;	// count of writes rejected as the log was full
 };
 
 class TraceLog : public Firebird::IpcObject
@@ -56,6 +58,8 @@ public:
 	bool isFull();		// true if free space left is less than threshold
 	void setFullMsg(const char* str);
 
+	ULONG resetDropped();	// returns and resets count of dropped writes
+
 private:
 	// flags in header
 	const ULONG FLAG_FULL = 0x0001;		// log is full, set by writer, reset by reader
@@ -309,6 +309,13 @@ void TraceSvcJrd::readSession(TraceSession& session)
 			{
 				// resume session
 				changeFlags(session.ses_id, 0, trs_log_full);
+
+				const ULONG dropped = log->resetDropped();
+				if (dropped)
+				{
+					m_svc.printf(false, "\n--- Session %u is resumed, %u trace events were dropped ---\n",
+						session.ses_id, dropped);
+				}
 			}
 		}
 	}
@@ -1950,14 +1950,12 @@ Validation::RTN Validation::walk_index(jrd_rel* relation, index_root_page& root_
 	temporary_key nullKey, *null_key = 0;
 	if (unique)
 	{
-		const bool isExpression = root_page.irt_rpt[id].irt_flags & irt_expression;
-		if (isExpression)
-			root_page.irt_rpt[id].irt_flags &= ~irt_expression;
+		const UCHAR exprFlags = root_page.irt_rpt[id].irt_flags & (irt_expression | irt_condition);
+		root_page.irt_rpt[id].irt_flags &= ~exprFlags;
 
 		index_desc idx;
 		BTR_description(vdr_tdbb, relation, &root_page, &idx, id);
-		if (isExpression)
-			root_page.irt_rpt[id].irt_flags |= irt_expression;
+		root_page.irt_rpt[id].irt_flags |= exprFlags;
 
 		null_key = &nullKey;
 		BTR_make_null_key(vdr_tdbb, &idx, null_key);
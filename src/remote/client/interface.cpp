@@ -612,6 +612,8 @@ int Replicator::release()
 class Statement FB_FINAL : public RefCntIface<IStatementImpl<Statement, CheckStatusWrapper> >
 {
 public:
+	static const ULONG PIPELINE_LIMIT = 64;
+
 	// IStatement implementation
 	int release() override;
 	void getInfo(CheckStatusWrapper* status,
@@ -691,6 +693,7 @@ public:
 
 private:
 	void freeClientData(CheckStatusWrapper* status, bool force = false);
+	bool pipelineAllowed(rem_port* port);
 
 	StatementMetadata metadata;
 	Attachment* remAtt;
@@ -1047,6 +1050,7 @@ static rem_port* analyze(ClntAuthBlock& cBlock, PathName& attach_name, unsigned
 	Firebird::ICryptKeyCallback* cryptCb);
 static void batch_gds_receive(rem_port*, struct rmtque *, USHORT);
 static void batch_dsql_fetch(rem_port*, struct rmtque *, USHORT);
+static void check_pipeline(Rdb*, Rtr*);
 static void clear_queue(rem_port*);
 static void clear_stmt_que(rem_port*, Rsr*);
 static void disconnect(rem_port*);
@@ -1080,6 +1084,8 @@ static void send_packet(rem_port*, PACKET *);
 static void send_partial_packet(rem_port*, PACKET *);
 static void server_death(rem_port*);
 static void svcstart(CheckStatusWrapper*, Rdb*, P_OP, USHORT, USHORT, USHORT, const UCHAR*);
+static const char* sqlKeyword(const char*, const char*, const char*);
+static void sync_pipeline(Rdb*);
 static void unsupported();
 static void zap_packet(PACKET *);
 static void cleanDpb(Firebird::ClumpletWriter&, const ParametersSet*);
@@ -1102,7 +1108,8 @@ inline static void reset(IStatus* status) throw()
 
 #define SET_OBJECT(rdb, object, id) rdb->rdb_port->setHandle(object, id)
 
-inline static void defer_packet(rem_port* port, PACKET* packet, bool sent = false)
+inline static void defer_packet(rem_port* port, PACKET* packet, bool sent = false,
+	bool pipelined = false)
 {
 	// hvlad: passed packet often is rdb->rdb_packet and therefore can be
 	// changed inside clear_queue. To not confuse caller we must preserve
@@ -1111,6 +1118,7 @@ inline static void defer_packet(rem_port* port, PACKET* packet, bool sent = fals
 	rem_que_packet p;
 	p.packet = *packet;
 	p.sent = sent;
+	p.pipelined = pipelined;
 
 	clear_queue(port);
 	*packet = p.packet;
@@ -1500,6 +1508,7 @@ void Transaction::deprecatedCommit(CheckStatusWrapper* status)
 		rem_port* port = rdb->rdb_port;
 		RefMutexGuard portGuard(*port->port_sync, FB_FUNCTION);
 
+		check_pipeline(rdb, transaction);
 		release_object(status, rdb, op_commit, transaction->rtr_id);
 		REMOTE_cleanup_transaction(transaction);
 		release_transaction(transaction);
@@ -1541,6 +1550,7 @@ void Transaction::commitRetaining(CheckStatusWrapper* status)
 		rem_port* port = rdb->rdb_port;
 		RefMutexGuard portGuard(*port->port_sync, FB_FUNCTION);
 
+		check_pipeline(rdb, transaction);
 		release_object(status, rdb, op_commit_retaining, transaction->rtr_id);
 	}
 	catch (const Exception& ex)
@@ -3334,6 +3344,16 @@ ITransaction* Statement::execute(CheckStatusWrapper* status, ITransaction* apiTr
 			message = statement->rsr_message = statement->rsr_buffer;
 		}
 
+		// DML without output may be streamed to the server without waiting for
+		// the response. Errors of such executions are kept in the transaction
+		// and reported by its commit, including a COMMIT statement.
+
+		const bool pipeline = transaction && !out_msg_length && pipelineAllowed(port);
+		const unsigned stmtType = transaction ? metadata.getType() : 0;
+
+		if (stmtType == isc_info_sql_stmt_commit)
+			check_pipeline(rdb, transaction);
+
 		message->msg_address = const_cast<UCHAR*>(in_msg);
 		statement->rsr_flags.clear(Rsr::FETCHED);
 		statement->rsr_format = statement->rsr_bind_format;
@@ -3355,6 +3375,26 @@ ITransaction* Statement::execute(CheckStatusWrapper* status, ITransaction* apiTr
 		sqldata->p_sqldata_out_message_number = 0;	// out_msg_type
 		sqldata->p_sqldata_timeout = statement->rsr_timeout;
 
+		if (pipeline)
+		{
+			// The response is received (and possible error is saved in the
+			// transaction) when the deferred packets queue is cleared
+
+			send_partial_packet(port, packet);
+			defer_packet(port, packet, true, true);
+			message->msg_address = NULL;
+
+			statement->rsr_rtr = transaction;
+			statement->rsr_flags.set(Rsr::PIPELINED);
+			transaction->rtr_pipelined++;
+
+			// Don't let unread responses fill the wire
+			if (port->port_deferred_packets->getCount() >= PIPELINE_LIMIT)
+				sync_pipeline(rdb);
+
+			return apiTra;
+		}
+
 		send_packet(port, packet);
 
 		// Set up the response packet.  We may receive an SQL response followed
@@ -3383,6 +3423,11 @@ ITransaction* Statement::execute(CheckStatusWrapper* status, ITransaction* apiTr
 			statement->rsr_rtr = NULL;
 			return NULL;
 		}
+		else if (stmtType == isc_info_sql_stmt_rollback && !(status->getState() & IStatus::STATE_ERRORS))
+		{
+			// ROLLBACK RETAINING undid the failed executions too
+			transaction->rtr_status.clear();
+		}
 		else if (!transaction && packet->p_resp.p_resp_object)
 		{
 			transaction = make_transaction(rdb, packet->p_resp.p_resp_object);
@@ -3400,6 +3445,38 @@ ITransaction* Statement::execute(CheckStatusWrapper* status, ITransaction* apiTr
 }
 
 
+bool Statement::pipelineAllowed(rem_port* port)
+{
+/**************************************
+ *
+ *	p i p e l i n e A l l o w e d
+ *
+ **************************************
+ *
+ * Functional description
+ *	Check whether execution of the statement may be streamed
+ *	to the server without waiting for the response.
+ *
+ **************************************/
+
+	if (port->port_protocol < PROTOCOL_VERSION17 || !(port->port_flags & PORT_lazy) ||
+		!port->getPortConfig()->getWirePipeline())
+	{
+		return false;
+	}
+
+	switch (metadata.getType())
+	{
+	case isc_info_sql_stmt_insert:
+	case isc_info_sql_stmt_update:
+	case isc_info_sql_stmt_delete:
+		return true;
+	}
+
+	return false;
+}
+
+
 ResultSet* Statement::openCursor(CheckStatusWrapper* status, Firebird::ITransaction* apiTra,
 	IMessageMetadata* inMetadata, void* inBuffer, IMessageMetadata* outFormat, unsigned int /*flags*/)
 {
@@ -3681,6 +3758,26 @@ ITransaction* Attachment::execute(CheckStatusWrapper* status, ITransaction* apiT
 
 		statement->clearException();
 
+		// COMMIT must report errors of the executions streamed in the transaction
+		// and ROLLBACK RETAINING discards them, like the transaction methods do
+
+		bool rollbackRetaining = false;
+
+		if (transaction && (transaction->rtr_pipelined || transaction->rtr_status.getError()))
+		{
+			const char* const end = sqlStmt + stmtLength;
+
+			if (sqlKeyword(sqlStmt, end, "COMMIT"))
+				check_pipeline(rdb, transaction);
+			else if (const char* p = sqlKeyword(sqlStmt, end, "ROLLBACK"))
+			{
+				if (const char* work = sqlKeyword(p, end, "WORK"))
+					p = work;
+
+				rollbackRetaining = sqlKeyword(p, end, "RETAINING") != NULL;
+			}
+		}
+
 		// set up the packet for the other guy...
 
 		PACKET* packet = &rdb->rdb_packet;
@@ -3731,6 +3828,11 @@ ITransaction* Attachment::execute(CheckStatusWrapper* status, ITransaction* apiT
 			rt->clear();
 			return NULL;
 		}
+		else if (rollbackRetaining && !(status->getState() & IStatus::STATE_ERRORS))
+		{
+			fb_assert(!transaction->rtr_pipelined);
+			transaction->rtr_status.clear();
+		}
 		else if (!transaction && packet->p_resp.p_resp_object)
 		{
 			transaction = make_transaction(rdb, packet->p_resp.p_resp_object);
@@ -3776,7 +3878,24 @@ void Statement::freeClientData(CheckStatusWrapper* status, bool force)
 		rem_port* port = rdb->rdb_port;
 		RefMutexGuard portGuard(*port->port_sync, FB_FUNCTION);
 
-		fb_assert(statement->haveException() == 0);
+		// Receive responses of streamed executions while the statement exists,
+		// their errors are saved in the transactions to be reported by commit
+
+		if (statement->rsr_flags.test(Rsr::PIPELINED))
+		{
+			try
+			{
+				sync_pipeline(rdb);
+			}
+			catch (const Exception&)
+			{
+				if (!force)
+					throw;
+			}
+
+			statement->rsr_flags.clear(Rsr::PIPELINED);
+		}
+
 		statement->clearException();
 
 		if (statement->rsr_flags.test(Rsr::LAZY))
@@ -5063,6 +5182,17 @@ int Blob::getSegment(CheckStatusWrapper* status, unsigned int bufferLength, void
 				blob->rbl_ptr = blob->rbl_buffer = blob->rbl_data.getBuffer(new_size);
 				blob->rbl_buffer_length = (USHORT) new_size;
 			}
+			else if (blob->rbl_offset >= (SLONG) blob->rbl_buffer_length &&
+				blob->rbl_buffer_length < MAX_USHORT - sizeof(USHORT))
+			{
+				// The blob that didn't fit into the buffer is likely being read
+				// through, so ask for more data per round trip.
+
+				const ULONG new_size = MIN((ULONG) blob->rbl_buffer_length * 2, MAX_USHORT - sizeof(USHORT));
+
+				blob->rbl_ptr = blob->rbl_buffer = blob->rbl_data.getBuffer(new_size);
+				blob->rbl_buffer_length = (USHORT) new_size;
+			}
 
 			// We need more data.  Ask for it politely
 
@@ -5278,6 +5408,8 @@ void Transaction::prepare(CheckStatusWrapper* status, unsigned int msg_length, c
 
 		CHECK_LENGTH(port, msg_length);
 
+		check_pipeline(rdb, transaction);
+
 		PACKET* packet = &rdb->rdb_packet;
 		packet->p_operation = op_prepare2;
 		packet->p_prep.p_prep_transaction = transaction->rtr_id;
@@ -5908,6 +6040,12 @@ void Transaction::rollbackRetaining(CheckStatusWrapper* status)
 		RefMutexGuard portGuard(*port->port_sync, FB_FUNCTION);
 
 		release_object(status, rdb, op_rollback_retaining, transaction->rtr_id);
+
+		// Responses of the streamed executions were received before the rollback
+		// one, their errors are of no interest anymore
+
+		fb_assert(!transaction->rtr_pipelined);
+		transaction->rtr_status.clear();
 	}
 	catch (const Exception& ex)
 	{
@@ -7421,6 +7559,40 @@ static void batch_gds_receive(rem_port*		port,
 }
 
 
+static void check_pipeline(Rdb* rdb, Rtr* transaction)
+{
+/**************************************
+ *
+ *	c h e c k _ p i p e l i n e
+ *
+ **************************************
+ *
+ * Functional description
+ *	Wait for responses of all executions streamed in the
+ *	transaction and report the first failed one, if any.
+ *	Called before the transaction is committed or prepared.
+ *
+ **************************************/
+	if (transaction->rtr_pipelined)
+		sync_pipeline(rdb);
+
+	fb_assert(!transaction->rtr_pipelined);
+
+	if (transaction->rtr_status.getError())
+	{
+		try
+		{
+			transaction->rtr_status.raise();
+		}
+		catch (const Exception&)
+		{
+			transaction->rtr_status.clear();
+			throw;
+		}
+	}
+}
+
+
 static void clear_queue(rem_port* port)
 {
 /**************************************
@@ -8267,6 +8439,7 @@ static void receive_packet_noqueue(rem_port* port, PACKET* packet)
 
 			OBJCT stmt_id = 0;
 			bool bCheckResponse = false, bFreeStmt = false, bAssign = false;
+			const bool pipelined = p->pipelined;
 
 			switch (p->packet.p_operation)
 			{
@@ -8293,7 +8466,36 @@ static void receive_packet_noqueue(rem_port* port, PACKET* packet)
 			if (bCheckResponse || bFreeStmt)
 				statement = port->port_objects[stmt_id];
 
-			if (bCheckResponse)
+			if (pipelined)
+			{
+				// Error of a streamed execution is reported by the commit of the
+				// transaction it was executed in, whatever the statement does next
+
+				const OBJCT tran_id = p->packet.p_sqldata.p_sqldata_transaction;
+				Rtr* transaction = port->port_objects[tran_id];
+
+				fb_assert(transaction->rtr_pipelined);
+				transaction->rtr_pipelined--;
+
+				Rdb* rdb = port->port_context;
+				LocalStatus ls;
+				CheckStatusWrapper status(&ls);
+
+				try
+				{
+					REMOTE_check_response(&status, rdb, &p->packet);
+				}
+				catch (const Exception& ex)
+				{
+					ex.stuffException(&status);
+				}
+
+				if ((status.getState() & IStatus::STATE_ERRORS) && !transaction->rtr_status.getError())
+					transaction->rtr_status.save(&status);
+
+				statement->rsr_rtr = transaction;
+			}
+			else if (bCheckResponse)
 			{
 				try
 				{
@@ -8878,6 +9080,88 @@ static void svcstart(CheckStatusWrapper*	status,
 }
 
 
+static const char* sqlKeyword(const char* sql, const char* end, const char* keyword)
+{
+/**************************************
+ *
+ *	s q l K e y w o r d
+ *
+ **************************************
+ *
+ * Functional description
+ *	Check whether the SQL statement text starts with the given
+ *	keyword, skipping leading blanks and comments. Return the
+ *	position after the keyword or NULL if it's not there.
+ *
+ **************************************/
+	if (!sql)
+		return NULL;
+
+	const char* p = sql;
+
+	while (p < end)
+	{
+		if (isspace(UCHAR(*p)))
+			++p;
+		else if (p + 1 < end && p[0] == '-' && p[1] == '-')
+		{
+			while (p < end && *p != '\n')
+				++p;
+		}
+		else if (p + 1 < end && p[0] == '/' && p[1] == '*')
+		{
+			for (p += 2; p + 1 < end && !(p[0] == '*' && p[1] == '/'); ++p)
+				;
+			p += 2;
+		}
+		else
+			break;
+	}
+
+	const FB_SIZE_T keywordLength = static_cast<FB_SIZE_T>(strlen(keyword));
+
+	if (p + keywordLength > end || fb_utils::strnicmp(p, keyword, keywordLength))
+		return NULL;
+
+	p += keywordLength;
+
+	if (p < end && (isalnum(UCHAR(*p)) || *p == '_' || *p == '$'))
+		return NULL;
+
+	return p;
+}
+
+
+static void sync_pipeline(Rdb* rdb)
+{
+/**************************************
+ *
+ *	s y n c _ p i p e l i n e
+ *
+ **************************************
+ *
+ * Functional description
+ *	Make a round trip to the server receiving responses
+ *	for all deferred packets sent before.
+ *
+ **************************************/
+	rem_port* port = rdb->rdb_port;
+	PACKET* packet = &rdb->rdb_packet;
+
+	packet->p_operation = op_batch_sync;
+	send_packet(port, packet);
+	receive_packet(port, packet);
+
+	LocalStatus warning;
+	port->checkResponse(&warning, packet, false);
+
+	// All streamed responses are received now
+
+	for (Rsr* statement = rdb->rdb_sql_requests; statement; statement = statement->rsr_next)
+		statement->rsr_flags.clear(Rsr::PIPELINED);
+}
+
+
 static void unsupported()
 {
 /**************************************
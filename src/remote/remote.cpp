@@ -162,7 +162,7 @@ void REMOTE_cleanup_transaction( Rtr* transaction)
 		if (statement->rsr_rtr == transaction)
 		{
 			REMOTE_reset_statement(statement);
-			statement->rsr_flags.clear(Rsr::FETCHED);
+			statement->rsr_flags.clear(Rsr::FETCHED | Rsr::PIPELINED);
 			statement->rsr_rtr = NULL;
 		}
 	}
@@ -200,12 +200,14 @@ struct Rtr : public Firebird::GlobalStorage, public TypedHandle<rem_type_rtr>
 
 	Firebird::Array<Rsr*> rtr_cursors;
 	Rtr**			rtr_self;
+	ULONG			rtr_pipelined;	// streamed executions with responses not received yet
+	Firebird::StatusHolder	rtr_status;	// first error of the streamed executions
 
 public:
 	Rtr() :
 		rtr_rdb(0), rtr_next(0), rtr_blobs(0),
 		rtr_iface(NULL), rtr_id(0), rtr_limbo(0),
-		rtr_cursors(getPool()), rtr_self(NULL)
+		rtr_cursors(getPool()), rtr_self(NULL), rtr_pipelined(0)
 	{ }
 
 	~Rtr()
@@ -533,7 +535,8 @@ public:
 		STREAM_ERR = 16,	// There is an error pending in the batched rows
 		LAZY = 32,			// To be allocated at the first reference
 		DEFER_EXECUTE = 64,	// op_execute can be deferred
-		PAST_EOF = 128		// EOF was returned by fetch from this statement
+		PAST_EOF = 128,		// EOF was returned by fetch from this statement
+		PIPELINED = 256		// op_execute was streamed, its response may be still pending
 	};
 
 public:
@@ -670,6 +673,7 @@ struct rem_que_packet
 {
 	PACKET packet;
 	bool sent;
+	bool pipelined;		// streamed op_execute, its error belongs to the transaction
 };
 
 typedef Firebird::Array<rem_que_packet> PacketQueue;
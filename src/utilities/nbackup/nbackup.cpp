@@ -54,6 +54,9 @@
 #include "../common/StatusArg.h"
 #include "../common/classes/objects_array.h"
 #include "../common/os/os_utils.h"
+#include "../common/ThreadStart.h"
+#include "../common/classes/semaphore.h"
+#include "../common/status.h"
 
 #ifdef HAVE_UNISTD_H
 #include <unistd.h>
@@ -352,6 +355,39 @@ private:
 	void write_file(FILE_HANDLE &file, void *buffer, FB_SIZE_T bufsize);
 	void seek_file(FILE_HANDLE &file, SINT64 pos);
 
+	// Writes the file by large blocks in a separate thread, thus reading
+	// of the database is not stalled by writing of the backup file
+	class PipedWriter
+	{
+	public:
+		PipedWriter(NBackup* nbackup, FILE_HANDLE& file);
+		~PipedWriter();
+
+		void write(const void* data, FB_SIZE_T length);
+		void finish();
+
+	private:
+		static const FB_SIZE_T BUFFER_SIZE = 1024 * 1024;
+
+		static THREAD_ENTRY_DECLARE writerThread(THREAD_ENTRY_PARAM arg);
+		void writeBuffers();
+		void post();
+		void stop();
+
+		NBackup* const m_nbackup;
+		FILE_HANDLE& m_file;
+		Array<UCHAR> m_unaligned[2];
+		UCHAR* m_buffers[2];
+		FB_SIZE_T m_lengths[2];
+		unsigned m_current;			// buffer being filled
+		FB_SIZE_T m_length;			// length of data in the current buffer
+		bool m_busy;				// writer thread has a buffer to write
+		bool m_stop;
+		Semaphore m_full, m_free;
+		Thread::Handle m_thread;
+		FbLocalStatus m_status;		// error of writer thread
+	};
+
 	void pr_error(const ISC_STATUS* status, const char* operation);
 	void print_child_stderr();
 
@@ -365,7 +401,9 @@ private:
 
 	// Create/open database and backup
 	void open_database_write(bool exclusive = false);
-	void open_database_scan();
+	void open_database_scan(bool sparse);
+	void prefetch_changed_pages(const Ods::scns_page* scns, ULONG pagesPerSCN, ULONG prev_scn,
+		ULONG page_size);
 	void create_database();
 	void close_database();
 
@@ -431,21 +469,148 @@ FB_SIZE_T NBackup::read_file(FILE_HANDLE &file, void *buffer, FB_SIZE_T bufsize)
 
 void NBackup::write_file(FILE_HANDLE &file, void *buffer, FB_SIZE_T bufsize)
 {
+	// Pipes and interrupted calls may write less than requested,
+	// so write the rest until the whole buffer is done
+
+	while (bufsize)
+	{
 #ifdef WIN_NT
-	DWORD bytesDone;
-	if (WriteFile(file, buffer, bufsize, &bytesDone, NULL) && bytesDone == bufsize)
-		return;
+		DWORD bytesDone;
+		if (!WriteFile(file, buffer, bufsize, &bytesDone, NULL) || !bytesDone)
+			break;
 #else
-	if (write(file, buffer, bufsize) == (ssize_t) bufsize)
-		return;
+		const ssize_t bytesDone = write(file, buffer, bufsize);
+		if (bytesDone < 0 && SYSCALL_INTERRUPTED(errno))
+			continue;
+		if (bytesDone <= 0)
+			break;
 #endif
 
+		bufsize -= bytesDone;
+		buffer = &((UCHAR*) buffer)[bytesDone];
+	}
+
+	if (!bufsize)
+		return;
+
 	status_exception::raise(Arg::Gds(isc_nbackup_err_write) <<
 		(&file == &dbase ? dbname.c_str() :
 			&file == &backup ? bakname.c_str() : "unknown") <<
 		Arg::OsError());
 }
 
+NBackup::PipedWriter::PipedWriter(NBackup* nbackup, FILE_HANDLE& file)
+	: m_nbackup(nbackup), m_file(file), m_current(0), m_length(0), m_busy(false), m_stop(false)
+{
+	for (unsigned i = 0; i < 2; i++)
+	{
+		UCHAR* const buf = m_unaligned[i].getBuffer(BUFFER_SIZE + SECTOR_ALIGNMENT);
+		m_buffers[i] = FB_ALIGN(buf, SECTOR_ALIGNMENT);
+		m_lengths[i] = 0;
+	}
+
+	Thread::start(writerThread, this, THREAD_medium, &m_thread);
+}
+
+NBackup::PipedWriter::~PipedWriter()
+{
+	if (!m_stop)
+		stop();
+}
+
+void NBackup::PipedWriter::write(const void* data, FB_SIZE_T length)
+{
+	const UCHAR* ptr = static_cast<const UCHAR*>(data);
+
+	while (length)
+	{
+		const FB_SIZE_T n = MIN(length, BUFFER_SIZE - m_length);
+		memcpy(m_buffers[m_current] + m_length, ptr, n);
+
+		m_length += n;
+		ptr += n;
+		length -= n;
+
+		if (m_length == BUFFER_SIZE)
+			post();
+	}
+}
+
+void NBackup::PipedWriter::finish()
+{
+	if (m_length)
+		post();
+
+	stop();
+	m_status.check();
+}
+
+void NBackup::PipedWriter::post()
+{
+	// Wait for the writer thread to complete previous buffer and
+	// pass it the current one, while the other one will be filled
+
+	if (m_busy)
+	{
+		m_free.enter();
+		m_busy = false;
+	}
+
+	m_status.check();
+
+	m_lengths[m_current] = m_length;
+	m_busy = true;
+	m_full.release();
+
+	m_current = 1 - m_current;
+	m_length = 0;
+}
+
+void NBackup::PipedWriter::stop()
+{
+	if (m_busy)
+	{
+		m_free.enter();
+		m_busy = false;
+	}
+
+	m_stop = true;
+	m_full.release();
+	Thread::waitForCompletion(m_thread);
+}
+
+THREAD_ENTRY_DECLARE NBackup::PipedWriter::writerThread(THREAD_ENTRY_PARAM arg)
+{
+	static_cast<PipedWriter*>(arg)->writeBuffers();
+	return 0;
+}
+
+void NBackup::PipedWriter::writeBuffers()
+{
+	for (unsigned n = 0; ; n = 1 - n)
+	{
+		m_full.enter();
+
+		if (m_stop)
+			break;
+
+		// After an error the rest of buffers are just skipped
+		if (m_status.isSuccess())
+		{
+			try
+			{
+				m_nbackup->write_file(m_file, m_buffers[n], m_lengths[n]);
+			}
+			catch (const Exception& ex)
+			{
+				ex.stuffException(&m_status);
+			}
+		}
+
+		m_free.release();
+	}
+}
+
 void NBackup::seek_file(FILE_HANDLE &file, SINT64 pos)
 {
 #ifdef WIN_NT
@@ -492,7 +657,7 @@ void NBackup::open_database_write(bool exclusive)
 	status_exception::raise(Arg::Gds(isc_nbackup_err_opendb) << dbname.c_str() << Arg::OsError());
 }
 
-void NBackup::open_database_scan()
+void NBackup::open_database_scan(bool sparse)
 {
 #ifdef WIN_NT
 
@@ -505,7 +670,8 @@ void NBackup::open_database_scan()
 	// system cache when reading large files.
 	dbase = CreateFile(dbname.c_str(),
 		GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING,
-		FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN | (direct_io ? FILE_FLAG_NO_BUFFERING : 0),
+		FILE_ATTRIBUTE_NORMAL | (sparse ? FILE_FLAG_RANDOM_ACCESS : FILE_FLAG_SEQUENTIAL_SCAN) |
+			(direct_io ? FILE_FLAG_NO_BUFFERING : 0),
 		NULL);
 	if (dbase == INVALID_HANDLE_VALUE)
 		status_exception::raise(Arg::Gds(isc_nbackup_err_opendb) << dbname.c_str() << Arg::OsError());
@@ -535,12 +701,32 @@ void NBackup::open_database_scan()
 		status_exception::raise(Arg::Gds(isc_nbackup_err_opendb) << dbname.c_str() << Arg::OsError());
 	}
 
+	int rc = 0;
+
+	// Incremental backup reads changed pages only. Do not let OS read ahead
+	// the unchanged ones, changed pages are prefetched explicitly.
+
+#ifdef POSIX_FADV_RANDOM
+	if (sparse)
+	{
+		rc = fb_fadvise(dbase, 0, 0, POSIX_FADV_RANDOM);
+		if (rc)
+		{
+			status_exception::raise(Arg::Gds(isc_nbackup_err_fadvice) <<
+									"RANDOM" << dbname.c_str() << Arg::Unix(rc));
+		}
+	}
+#endif // POSIX_FADV_RANDOM
+
 #ifdef POSIX_FADV_SEQUENTIAL
-	int rc = fb_fadvise(dbase, 0, 0, POSIX_FADV_SEQUENTIAL);
-	if (rc)
+	if (!sparse)
 	{
-		status_exception::raise(Arg::Gds(isc_nbackup_err_fadvice) <<
-								"SEQUENTIAL" << dbname.c_str() << Arg::Unix(rc));
+		rc = fb_fadvise(dbase, 0, 0, POSIX_FADV_SEQUENTIAL);
+		if (rc)
+		{
+			status_exception::raise(Arg::Gds(isc_nbackup_err_fadvice) <<
+									"SEQUENTIAL" << dbname.c_str() << Arg::Unix(rc));
+		}
 	}
 #endif // POSIX_FADV_SEQUENTIAL
 
@@ -559,6 +745,38 @@ void NBackup::open_database_scan()
 #endif // WIN_NT
 }
 
+void NBackup::prefetch_changed_pages(const Ods::scns_page* scns, ULONG pagesPerSCN, ULONG prev_scn,
+	ULONG page_size)
+{
+	// Ask OS to read in advance the pages changed after previous level backup
+	// among the pages covered by given SCN page. Adjacent pages are requested
+	// by a single call. It's just a hint, therefore errors are ignored.
+
+#if defined(POSIX_FADV_WILLNEED) && !defined(WIN_NT)
+	if (direct_io)
+		return;
+
+	const ULONG firstPage = scns->scn_sequence * pagesPerSCN;
+	ULONG slot = 0;
+
+	while (slot < pagesPerSCN)
+	{
+		if (scns->scn_pages[slot] <= prev_scn)
+		{
+			slot++;
+			continue;
+		}
+
+		const ULONG start = slot;
+		while (slot < pagesPerSCN && scns->scn_pages[slot] > prev_scn)
+			slot++;
+
+		fb_fadvise(dbase, (off_t) (firstPage + start) * page_size,
+			(off_t) (slot - start) * page_size, POSIX_FADV_WILLNEED);
+	}
+#endif
+}
+
 void NBackup::create_database()
 {
 #ifdef WIN_NT
@@ -1292,7 +1510,7 @@ void NBackup::backup_database(int level, Guid& guid, const PathName& fname)
 		create_backup();
 		delete_backup = true;
 
-		open_database_scan();
+		open_database_scan(level != 0);
 
 		// Read database header
 		char unaligned_header_buffer[RAW_HEADER_SIZE + SECTOR_ALIGNMENT];
@@ -1353,6 +1571,7 @@ void NBackup::backup_database(int level, Guid& guid, const PathName& fname)
 			status_exception::raise(Arg::Gds(isc_nbackup_lostguid_bk));
 
 		// Write data to backup file
+		PipedWriter writer(this, backup);
 		ULONG backup_scn = header->hdr_header.pag_scn - 1;
 		if (level)
 		{
@@ -1368,7 +1587,7 @@ void NBackup::backup_database(int level, Guid& guid, const PathName& fname)
 
 			memset(page_buff, 0, header->hdr_page_size);
 			memcpy(page_buff, &bh, sizeof(bh));
-			write_file(backup, page_buff, header->hdr_page_size);
+			writer.write(page_buff, header->hdr_page_size);
 			page_writes++;
 
 			seek_file(dbase, 0);
@@ -1400,7 +1619,7 @@ void NBackup::backup_database(int level, Guid& guid, const PathName& fname)
 
 			if (!level || page_buff->pag_scn > prev_scn)
 			{
-				write_file(backup, page_buff, header->hdr_page_size);
+				writer.write(page_buff, header->hdr_page_size);
 				page_writes++;
 			}
 
@@ -1460,6 +1679,8 @@ void NBackup::backup_database(int level, Guid& guid, const PathName& fname)
 				// pick up next SCN's page
 				memcpy(scns_buf, page_buff, header->hdr_page_size);
 				scns = scns_buf;
+
+				prefetch_changed_pages(scns, pagesPerSCN, prev_scn, header->hdr_page_size);
 			}
 
 
@@ -1488,6 +1709,7 @@ void NBackup::backup_database(int level, Guid& guid, const PathName& fname)
 				}
 			}
 		}
+		writer.finish();
 		close_database();
 		close_backup();
 
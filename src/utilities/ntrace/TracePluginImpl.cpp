@@ -508,6 +508,30 @@ void TracePluginImpl::appendGlobalCounts(const PerformanceInfo* info)
 		record.append(temp);
 	}
 
+	if ((cnt = info->pin_counters[PerformanceInfo::PAGE_READ_TIME]) != 0)
+	{
+		temp.printf(", %" QUADFORMAT"d us read time", cnt);
+		record.append(temp);
+	}
+
+	if ((cnt = info->pin_counters[PerformanceInfo::PAGE_WRITE_TIME]) != 0)
+	{
+		temp.printf(", %" QUADFORMAT"d us write time", cnt);
+		record.append(temp);
+	}
+
+	if ((cnt = info->pin_counters[PerformanceInfo::LATCH_WAIT_TIME]) != 0)
+	{
+		temp.printf(", %" QUADFORMAT"d us latch wait", cnt);
+		record.append(temp);
+	}
+
+	if ((cnt = info->pin_counters[PerformanceInfo::LOCK_WAIT_TIME]) != 0)
+	{
+		temp.printf(", %" QUADFORMAT"d us lock wait", cnt);
+		record.append(temp);
+	}
+
 	record.append(NEWLINE);
 }
 